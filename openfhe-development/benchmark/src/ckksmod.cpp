@@ -35,11 +35,25 @@
 
 #define PROFILE
 
+#include <atomic>
 #include <chrono>
+#include <cstdlib>
+#include <cstring>
 #include <functional>
+#include <new>
 #include <optional>
 
+#if defined(__linux__)
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
 #include "openfhe.h"
+#include "ciphertext-ser.h"
+#include "cryptocontext-ser.h"
+#include "key/key-ser.h"
 
 using namespace lbcrypto;
 
@@ -124,6 +138,108 @@ int runRankRed() {
                                        cc->EvalRankReduce(c1, rankredKey);
                                    })
                       << std::endl;
+
+            // throughput over a batch sharing the key: one reduction at a time vs. the blocked batch
+            const size_t batch = 16;
+            std::vector<ConstCiphertext<DCRTModule>> cts(batch, c1);
+
+            std::cout << "RankRedLoop" << batch << "," << ringDim << "," << moduleRank << "," << scaleModSize << ","
+                      << multDepth << "," << newRank << ","
+                      << benchmark(cc, keys, ptxt1, c1, c1, std::nullopt,
+                                   [&cts, rankredKey](CC cc, Keys keys, Plaintext pt, CT, CT, std::optional<CT>) {
+                                       for (const auto& ct : cts)
+                                           cc->EvalRankReduce(ct, rankredKey);
+                                   })
+                      << std::endl;
+
+            std::cout << "RankRedBatch" << batch << "," << ringDim << "," << moduleRank << "," << scaleModSize << ","
+                      << multDepth << "," << newRank << ","
+                      << benchmark(cc, keys, ptxt1, c1, c1, std::nullopt,
+                                   [&cts, rankredKey](CC cc, Keys keys, Plaintext pt, CT, CT, std::optional<CT>) {
+                                       cc->EvalRankReduceBatch(cts, rankredKey);
+                                   })
+                      << std::endl;
+        }
+    }
+
+    return 0;
+}
+
+int runRankExtend() {
+    std::cout << "operation,ringDim,rank,scaleModSize,multDepth,lowRank,iterations,ms" << std::endl;
+    uint32_t scaleModSize = 50;
+
+    for (uint32_t moduleRank = 2; moduleRank <= 16; moduleRank *= 2) {
+        for (uint32_t lowRank = 1; lowRank < moduleRank; lowRank *= 2) {
+            uint32_t ringDim   = 1024;
+            uint32_t multDepth = 2;
+            CCParams<CryptoContextCKKSMod> parameters;
+            parameters.SetRingDim(ringDim);
+            parameters.SetSecurityLevel(HEStd_NotSet);
+            parameters.SetMultiplicativeDepth(multDepth);
+            parameters.SetScalingModSize(scaleModSize);
+            parameters.SetBatchSize(8);
+            parameters.SetModuleRank(moduleRank);
+            parameters.SetScalingTechnique(FLEXIBLEAUTOEXT);
+
+            CryptoContext<DCRTModule> cc = GenCryptoContext(parameters);
+
+            cc->Enable(PKE);
+            cc->Enable(LEVELEDSHE);
+            cc->Enable(KEYSWITCH);
+
+            auto keys = cc->KeyGen();
+            cc->EvalMultModKeyGen(keys.secretKey);
+
+            PrivateKey<DCRTModule> lowKey;
+            // the lower-rank key gets its own tag so that both sets of relinearization keys are kept
+            auto reduceKey = cc->EvalRankRedKeyGen(keys.secretKey, lowKey, lowRank, true);
+            cc->EvalMultModKeyGen(lowKey);
+            auto extendKey = cc->EvalRankExtendKeyGen(lowKey, keys.secretKey);
+
+            std::vector<double> x1 = {0.25, 0.5, 0.75, 1.0, 2.0, 3.0, 4.0, 5.0};
+            Plaintext ptxt1        = cc->MakeCKKSPackedPlaintext(x1);
+
+            auto c1 = cc->Encrypt(keys.publicKey, ptxt1);
+            auto c2 = cc->Encrypt(keys.publicKey, ptxt1);
+            // inputs that arrive at the lower rank
+            CT c1Low = cc->EvalRankReduce(c1, reduceKey);
+            CT c2Low = cc->EvalRankReduce(c2, reduceKey);
+
+            std::cout << "RankExtendKeyGen," << ringDim << "," << moduleRank << "," << scaleModSize << ","
+                      << multDepth << "," << lowRank << ","
+                      << benchmark(cc, keys, ptxt1, c1, c2, std::nullopt,
+                                   [lowKey](CC cc, Keys keys, Plaintext, CT, CT, std::optional<CT>) {
+                                       cc->EvalRankExtendKeyGen(lowKey, keys.secretKey);
+                                   })
+                      << std::endl;
+
+            std::cout << "RankExtend," << ringDim << "," << moduleRank << "," << scaleModSize << "," << multDepth
+                      << "," << lowRank << ","
+                      << benchmark(cc, keys, ptxt1, c1Low, c2Low, std::nullopt,
+                                   [extendKey](CC cc, Keys, Plaintext, CT c1, CT, std::optional<CT>) {
+                                       cc->EvalRankExtend(c1, extendKey);
+                                   })
+                      << std::endl;
+
+            // c1 * c2 + c1 with all work at the full rank ...
+            std::cout << "MixedFullRank," << ringDim << "," << moduleRank << "," << scaleModSize << "," << multDepth
+                      << "," << lowRank << ","
+                      << benchmark(cc, keys, ptxt1, c1, c2, std::nullopt,
+                                   [](CC cc, Keys, Plaintext, CT c1, CT c2, std::optional<CT>) {
+                                       cc->EvalAdd(cc->EvalMultAndRelinearize(c1, c2), c1);
+                                   })
+                      << std::endl;
+
+            // ... and with the product at the lower rank, extended only to combine with c1
+            std::cout << "MixedLowRank," << ringDim << "," << moduleRank << "," << scaleModSize << "," << multDepth
+                      << "," << lowRank << ","
+                      << benchmark(cc, keys, ptxt1, c1Low, c2Low, c1,
+                                   [extendKey](CC cc, Keys, Plaintext, CT c1, CT c2, std::optional<CT> c3) {
+                                       cc->EvalAdd(cc->EvalRankExtend(cc->EvalMultAndRelinearize(c1, c2), extendKey),
+                                                   *c3);
+                                   })
+                      << std::endl;
         }
     }
 
@@ -206,6 +322,46 @@ int runBaseOperations() {
                                        })
                           << std::endl;
 
+                std::cout << "EvalSquareNoRelin," << ringDim << "," << moduleRank << "," << scaleModSize << ","
+                          << multDepth << ","
+                          << benchmark(cc, keys, ptxt1, c1, c2, std::nullopt,
+                                       [](CC cc, Keys, Plaintext, CT c1, CT, std::optional<CT>) {
+                                           cc->GetScheme()->EvalSquare(c1);
+                                       })
+                          << std::endl;
+
+                std::cout << "EvalAddPlain," << ringDim << "," << moduleRank << "," << scaleModSize << ","
+                          << multDepth << ","
+                          << benchmark(cc, keys, ptxt2, c1, c2, std::nullopt,
+                                       [](CC cc, Keys, Plaintext pt, CT c1, CT, std::optional<CT>) {
+                                           cc->EvalAdd(c1, pt);
+                                       })
+                          << std::endl;
+
+                std::cout << "EvalMultPlain," << ringDim << "," << moduleRank << "," << scaleModSize << ","
+                          << multDepth << ","
+                          << benchmark(cc, keys, ptxt2, c1, c2, std::nullopt,
+                                       [](CC cc, Keys, Plaintext pt, CT c1, CT, std::optional<CT>) {
+                                           cc->EvalMult(c1, pt);
+                                       })
+                          << std::endl;
+
+                std::cout << "EvalAddScalar," << ringDim << "," << moduleRank << "," << scaleModSize << ","
+                          << multDepth << ","
+                          << benchmark(cc, keys, ptxt2, c1, c2, std::nullopt,
+                                       [](CC cc, Keys, Plaintext, CT c1, CT, std::optional<CT>) {
+                                           cc->EvalAdd(c1, 2.5);
+                                       })
+                          << std::endl;
+
+                std::cout << "EvalMultScalar," << ringDim << "," << moduleRank << "," << scaleModSize << ","
+                          << multDepth << ","
+                          << benchmark(cc, keys, ptxt2, c1, c2, std::nullopt,
+                                       [](CC cc, Keys, Plaintext, CT c1, CT, std::optional<CT>) {
+                                           cc->EvalMult(c1, 2.5);
+                                       })
+                          << std::endl;
+
                 if (ringDim * moduleRank <= 1024 * 32) {
                     cc->EvalMultModKeyGen(keys.secretKey);
 
@@ -223,7 +379,481 @@ int runBaseOperations() {
                                      cc, keys, ptxt1, c1, c2, cc->EvalMultNoRelin(c1, c2),
                                      [](CC cc, Keys, Plaintext, CT, CT, std::optional<CT> c3) { cc->Relinearize(*c3); })
                               << std::endl;
+
+                    std::cout << "EvalSquareAndRelinearize," << ringDim << "," << moduleRank << "," << scaleModSize
+                              << "," << multDepth << ","
+                              << benchmark(cc, keys, ptxt1, c1, c2, std::nullopt,
+                                           [](CC cc, Keys, Plaintext, CT c1, CT, std::optional<CT>) {
+                                               cc->EvalSquareAndRelinearize(c1);
+                                           })
+                              << std::endl;
+
+                    cc->EvalRotateKeyGen(keys.secretKey, {1, 2, 3, 4});
+
+                    std::cout << "EvalRotate," << ringDim << "," << moduleRank << "," << scaleModSize << ","
+                              << multDepth << ","
+                              << benchmark(cc, keys, ptxt1, c1, c2, std::nullopt,
+                                           [](CC cc, Keys, Plaintext, CT c1, CT, std::optional<CT>) {
+                                               cc->EvalRotate(c1, 1);
+                                           })
+                              << std::endl;
+
+                    // four hoisted rotations, one by one and as a batch
+                    std::cout << "EvalFastRotation4," << ringDim << "," << moduleRank << "," << scaleModSize << ","
+                              << multDepth << ","
+                              << benchmark(cc, keys, ptxt1, c1, c2, std::nullopt,
+                                           [](CC cc, Keys, Plaintext, CT c1, CT, std::optional<CT>) {
+                                               auto digits = cc->EvalFastRotationPrecompute(c1);
+                                               for (usint index = 1; index <= 4; ++index)
+                                                   cc->EvalFastRotation(c1, index, cc->GetCyclotomicOrder(), digits);
+                                           })
+                              << std::endl;
+
+                    std::cout << "EvalFastRotationBatch4," << ringDim << "," << moduleRank << "," << scaleModSize
+                              << "," << multDepth << ","
+                              << benchmark(cc, keys, ptxt1, c1, c2, std::nullopt,
+                                           [](CC cc, Keys, Plaintext, CT c1, CT, std::optional<CT>) {
+                                               auto digits = cc->EvalFastRotationPrecompute(c1);
+                                               cc->EvalFastRotationBatch(c1, {1, 2, 3, 4}, cc->GetCyclotomicOrder(),
+                                                                         digits);
+                                           })
+                              << std::endl;
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+// Heap allocations are only counted while countOperation runs; every other benchmark sees
+// malloc plus one relaxed load per allocation.
+static std::atomic<bool> countingAllocations{false};
+static std::atomic<size_t> heapAllocations{0};
+
+void* operator new(std::size_t size) {
+    if (countingAllocations.load(std::memory_order_relaxed))
+        heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+// operator new above allocates with malloc, but GCC matches free against the new expressions
+// that the deletes are inlined into
+#if defined(__GNUC__) && !defined(__clang__)
+    #if __GNUC__ >= 11
+        #pragma GCC diagnostic push
+        #pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+    #endif
+#endif
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+#if defined(__GNUC__) && !defined(__clang__)
+    #if __GNUC__ >= 11
+        #pragma GCC diagnostic pop
+    #endif
+#endif
+
+struct OperationCounts {
+    size_t allocations;
+    // hardware cache misses of the calling thread, when perf events are available
+    std::optional<uint64_t> cacheMisses;
+
+    friend std::ostream& operator<<(std::ostream& os, const OperationCounts& counts) {
+        os << counts.allocations << ",";
+        if (counts.cacheMisses)
+            return os << *counts.cacheMisses;
+        return os << "n/a";
+    }
+};
+
+// Runs op once and counts its heap allocations and, on Linux, its cache misses. Worker threads
+// are not followed by the cache miss counter, so run with OMP_NUM_THREADS=1 for complete figures.
+OperationCounts countOperation(const std::function<void()>& op) {
+    OperationCounts counts{0, std::nullopt};
+#if defined(__linux__)
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type           = PERF_TYPE_HARDWARE;
+    attr.size           = sizeof(attr);
+    attr.config         = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled       = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+    // fails in containers or with a restrictive perf_event_paranoid
+    const int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    if (fd >= 0) {
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+
+    size_t before = heapAllocations.load(std::memory_order_relaxed);
+    countingAllocations.store(true, std::memory_order_relaxed);
+    op();
+    countingAllocations.store(false, std::memory_order_relaxed);
+    counts.allocations = heapAllocations.load(std::memory_order_relaxed) - before;
+
+#if defined(__linux__)
+    if (fd >= 0) {
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        uint64_t misses = 0;
+        if (read(fd, &misses, sizeof(misses)) == sizeof(misses))
+            counts.cacheMisses = misses;
+        close(fd);
+    }
+#endif
+    return counts;
+}
+
+int runModuleOperations() {
+    std::cout << "operation,ringDim,rank,scaleModSize,multDepth,iterations,ms,allocations,cacheMisses" << std::endl;
+    uint32_t scaleModSize = 50;
+    uint32_t multDepth    = 2;
+    uint32_t ringDim      = 1024;
+
+    for (uint32_t moduleRank = 2; moduleRank <= 32; moduleRank *= 2) {
+        CCParams<CryptoContextCKKSMod> parameters;
+        parameters.SetRingDim(ringDim);
+        parameters.SetSecurityLevel(HEStd_NotSet);
+        parameters.SetMultiplicativeDepth(multDepth);
+        parameters.SetScalingModSize(scaleModSize);
+        parameters.SetBatchSize(8);
+        parameters.SetModuleRank(moduleRank);
+        parameters.SetScalingTechnique(FLEXIBLEAUTOEXT);
+
+        CryptoContext<DCRTModule> cc = GenCryptoContext(parameters);
+
+        cc->Enable(PKE);
+        cc->Enable(LEVELEDSHE);
+        cc->Enable(KEYSWITCH);
+
+        auto keys = cc->KeyGen();
+
+        std::vector<double> x1 = {0.25, 0.5, 0.75, 1.0, 2.0, 3.0, 4.0, 5.0};
+        std::vector<double> x2 = {5.0, 4.0, 3.0, 2.0, 1.0, 0.75, 0.5, 0.25};
+
+        Plaintext ptxt1 = cc->MakeCKKSPackedPlaintext(x1);
+        Plaintext ptxt2 = cc->MakeCKKSPackedPlaintext(x2);
+
+        auto c1 = cc->Encrypt(keys.publicKey, ptxt1);
+        auto c2 = cc->Encrypt(keys.publicKey, ptxt2);
+
+        const DCRTModule& A  = keys.publicKey->GetPublicElements()[1];
+        const DCRTModule& s  = keys.secretKey->GetPrivateElement();
+        const DCRTModule& a1 = c1->GetElements()[1];
+        const DCRTModule& a2 = c2->GetElements()[1];
+
+        std::cout << "Times," << ringDim << "," << moduleRank << "," << scaleModSize << "," << multDepth << ","
+                  << benchmark(cc, keys, ptxt1, c1, c2, std::nullopt,
+                               [&A, &s](CC, Keys, Plaintext, CT, CT, std::optional<CT>) { A.Times(s); })
+                  << "," << countOperation([&A, &s]() { A.Times(s); }) << std::endl;
+
+        std::cout << "HadamardProduct," << ringDim << "," << moduleRank << "," << scaleModSize << "," << multDepth
+                  << ","
+                  << benchmark(cc, keys, ptxt1, c1, c2, std::nullopt,
+                               [&a1, &a2](CC, Keys, Plaintext, CT, CT, std::optional<CT>) { a1.HadamardProduct(a2); })
+                  << "," << countOperation([&a1, &a2]() { a1.HadamardProduct(a2); }) << std::endl;
+
+        DCRTModule m(a1);
+        std::cout << "SwitchFormat," << ringDim << "," << moduleRank << "," << scaleModSize << "," << multDepth << ","
+                  << benchmark(cc, keys, ptxt1, c1, c2, std::nullopt,
+                               [&m](CC, Keys, Plaintext, CT, CT, std::optional<CT>) { m.SwitchFormat(); })
+                  << "," << countOperation([&m]() { m.SwitchFormat(); }) << std::endl;
+    }
+
+    return 0;
+}
+
+// Compares the one-pass DCRTModule::TensorProduct used by EvalMultCore with the separate products it
+// replaced (c0 * c0', the linear terms with MultiplyAddInPlace and SymmetricOuterProduct), and times
+// EvalMultNoRelin end to end, for each module rank.
+int runTensorProduct() {
+    std::cout << "operation,ringDim,rank,scaleModSize,multDepth,iterations,ms" << std::endl;
+    uint32_t scaleModSize = 50;
+    uint32_t multDepth    = 2;
+    uint32_t ringDim      = 1024;
+
+    for (uint32_t moduleRank = 1; moduleRank <= 16; moduleRank *= 2) {
+        CCParams<CryptoContextCKKSMod> parameters;
+        parameters.SetRingDim(ringDim);
+        parameters.SetSecurityLevel(HEStd_NotSet);
+        parameters.SetMultiplicativeDepth(multDepth);
+        parameters.SetScalingModSize(scaleModSize);
+        parameters.SetBatchSize(8);
+        parameters.SetModuleRank(moduleRank);
+        parameters.SetScalingTechnique(FLEXIBLEAUTOEXT);
+
+        CryptoContext<DCRTModule> cc = GenCryptoContext(parameters);
+
+        cc->Enable(PKE);
+        cc->Enable(LEVELEDSHE);
+        cc->Enable(KEYSWITCH);
+
+        auto keys = cc->KeyGen();
+
+        std::vector<double> x1 = {0.25, 0.5, 0.75, 1.0, 2.0, 3.0, 4.0, 5.0};
+        std::vector<double> x2 = {5.0, 4.0, 3.0, 2.0, 1.0, 0.75, 0.5, 0.25};
+
+        Plaintext ptxt1 = cc->MakeCKKSPackedPlaintext(x1);
+        Plaintext ptxt2 = cc->MakeCKKSPackedPlaintext(x2);
+
+        auto c1 = cc->Encrypt(keys.publicKey, ptxt1);
+        auto c2 = cc->Encrypt(keys.publicKey, ptxt2);
+
+        const std::vector<DCRTModule>& cv1 = c1->GetElements();
+        const std::vector<DCRTModule>& cv2 = c2->GetElements();
+
+        std::cout << "SeparateProducts," << ringDim << "," << moduleRank << "," << scaleModSize << "," << multDepth
+                  << ","
+                  << benchmark(cc, keys, ptxt1, c1, c2, std::nullopt,
+                               [&cv1, &cv2](CC, Keys, Plaintext, CT, CT, std::optional<CT>) {
+                                   std::vector<DCRTModule> cvMult(4);
+                                   cvMult[0] = cv1[0] * cv2[0];
+                                   cvMult[1] = cv1[1] * cv2[0];
+                                   cvMult[1].MultiplyAddInPlace(cv1[0], cv2[1]);
+                                   if (cv1[1].GetModuleCols() > 1)
+                                       cv1[1].SymmetricOuterProduct(cv2[1], cvMult[2], cvMult[3]);
+                                   else
+                                       cvMult[2] = cv1[1].HadamardProduct(cv2[1]);
+                               })
+                  << std::endl;
+
+        std::cout << "TensorProduct," << ringDim << "," << moduleRank << "," << scaleModSize << "," << multDepth
+                  << ","
+                  << benchmark(cc, keys, ptxt1, c1, c2, std::nullopt,
+                               [&cv1, &cv2](CC, Keys, Plaintext, CT, CT, std::optional<CT>) {
+                                   std::vector<DCRTModule> cvMult(4);
+                                   cv1[1].TensorProduct(cv1[0], cv2[1], cv2[0], cvMult[0], cvMult[1], cvMult[2],
+                                                        cvMult[3]);
+                               })
+                  << std::endl;
+
+        std::cout << "EvalMultNoRelin," << ringDim << "," << moduleRank << "," << scaleModSize << "," << multDepth
+                  << ","
+                  << benchmark(cc, keys, ptxt1, c1, c2, std::nullopt,
+                               [](CC cc, Keys, Plaintext, CT c1, CT c2, std::optional<CT>) {
+                                   cc->EvalMultNoRelin(c1, c2);
+                               })
+                  << std::endl;
+    }
+
+    return 0;
+}
+
+int runParallelScaling() {
+    std::cout << "operation,ringDim,rank,scaleModSize,multDepth,threads,iterations,ms" << std::endl;
+    uint32_t scaleModSize = 50;
+    uint32_t multDepth    = 2;
+    uint32_t ringDim      = 1024;
+    int machineThreads    = OpenFHEParallelControls.GetMachineThreads();
+
+    for (uint32_t moduleRank = 2; moduleRank <= 32; moduleRank *= 2) {
+        CCParams<CryptoContextCKKSMod> parameters;
+        parameters.SetRingDim(ringDim);
+        parameters.SetSecurityLevel(HEStd_NotSet);
+        parameters.SetMultiplicativeDepth(multDepth);
+        parameters.SetScalingModSize(scaleModSize);
+        parameters.SetBatchSize(8);
+        parameters.SetModuleRank(moduleRank);
+        parameters.SetScalingTechnique(FLEXIBLEAUTOEXT);
+
+        CryptoContext<DCRTModule> cc = GenCryptoContext(parameters);
+
+        cc->Enable(PKE);
+        cc->Enable(LEVELEDSHE);
+        cc->Enable(KEYSWITCH);
+
+        auto keys = cc->KeyGen();
+        cc->EvalMultModKeyGen(keys.secretKey);
+
+        std::vector<double> x1 = {0.25, 0.5, 0.75, 1.0, 2.0, 3.0, 4.0, 5.0};
+        std::vector<double> x2 = {5.0, 4.0, 3.0, 2.0, 1.0, 0.75, 0.5, 0.25};
+
+        Plaintext ptxt1 = cc->MakeCKKSPackedPlaintext(x1);
+        Plaintext ptxt2 = cc->MakeCKKSPackedPlaintext(x2);
+
+        auto c1 = cc->Encrypt(keys.publicKey, ptxt1);
+        auto c2 = cc->Encrypt(keys.publicKey, ptxt2);
+        auto c3 = cc->EvalMultNoRelin(c1, c2);
+
+        const DCRTModule& A = keys.publicKey->GetPublicElements()[1];
+        const DCRTModule& s = keys.secretKey->GetPrivateElement();
+        DCRTModule m(c1->GetElements()[1]);
+
+        for (int threads = 1; threads <= machineThreads; threads *= 2) {
+            OpenFHEParallelControls.SetNumThreads(threads);
+            std::string prefix = std::to_string(ringDim) + "," + std::to_string(moduleRank) + "," +
+                                 std::to_string(scaleModSize) + "," + std::to_string(multDepth) + "," +
+                                 std::to_string(threads) + ",";
+
+            std::cout << "SwitchFormat," << prefix
+                      << benchmark(cc, keys, ptxt1, c1, c2, std::nullopt,
+                                   [&m](CC, Keys, Plaintext, CT, CT, std::optional<CT>) { m.SwitchFormat(); })
+                      << std::endl;
+            std::cout << "Times," << prefix
+                      << benchmark(cc, keys, ptxt1, c1, c2, std::nullopt,
+                                   [&A, &s](CC, Keys, Plaintext, CT, CT, std::optional<CT>) { A.Times(s); })
+                      << std::endl;
+            std::cout << "Encrypt," << prefix
+                      << benchmark(cc, keys, ptxt1, c1, c2, std::nullopt,
+                                   [](CC cc, Keys keys, Plaintext pt, CT, CT, std::optional<CT>) {
+                                       cc->Encrypt(keys.publicKey, pt);
+                                   })
+                      << std::endl;
+            std::cout << "EvalMultNoRelin," << prefix
+                      << benchmark(cc, keys, ptxt1, c1, c2, std::nullopt,
+                                   [](CC cc, Keys, Plaintext, CT c1, CT c2, std::optional<CT>) {
+                                       cc->EvalMultNoRelin(c1, c2);
+                                   })
+                      << std::endl;
+            std::cout << "Relinearize," << prefix
+                      << benchmark(cc, keys, ptxt1, c1, c2, c3,
+                                   [](CC cc, Keys, Plaintext, CT, CT, std::optional<CT> c3) { cc->Relinearize(*c3); })
+                      << std::endl;
+            std::cout << "EvalMultModKeyGen," << prefix
+                      << benchmark(cc, keys, ptxt1, c1, c2, std::nullopt,
+                                   [](CC cc, Keys keys, Plaintext, CT, CT, std::optional<CT>) {
+                                       // the context caches keys per key tag, so call the scheme directly
+                                       cc->GetScheme()->EvalMultModKeyGen(keys.secretKey);
+                                   })
+                      << std::endl;
+        }
+        OpenFHEParallelControls.Enable();
+    }
+
+    return 0;
+}
+
+// Compares seed-compressed rank reduction keys with full ones: serialized size, and the cost of loading
+// a key and using it once, which for compressed keys includes regenerating A from the seed.
+int runKeyCompression() {
+    std::cout << "operation,ringDim,rank,scaleModSize,multDepth,newRank,bytes,iterations,ms" << std::endl;
+    uint32_t scaleModSize = 50;
+    uint32_t multDepth    = 2;
+
+    for (uint32_t ringDim = 1024; ringDim <= 1024 * 16; ringDim *= 4) {
+        for (uint32_t moduleRank = 2; moduleRank <= 16; moduleRank *= 2) {
+            uint32_t newRank = moduleRank / 2;
+            CCParams<CryptoContextCKKSMod> parameters;
+            parameters.SetRingDim(ringDim);
+            parameters.SetSecurityLevel(HEStd_NotSet);
+            parameters.SetMultiplicativeDepth(multDepth);
+            parameters.SetScalingModSize(scaleModSize);
+            parameters.SetBatchSize(8);
+            parameters.SetModuleRank(moduleRank);
+            parameters.SetScalingTechnique(FLEXIBLEAUTOEXT);
+            parameters.SetCompressEvalKeys(true);
+
+            CryptoContext<DCRTModule> cc = GenCryptoContext(parameters);
+
+            cc->Enable(PKE);
+            cc->Enable(LEVELEDSHE);
+            cc->Enable(KEYSWITCH);
+
+            auto keys = cc->KeyGen();
+
+            std::vector<double> x1 = {0.25, 0.5, 0.75, 1.0, 2.0, 3.0, 4.0, 5.0};
+
+            Plaintext ptxt1 = cc->MakeCKKSPackedPlaintext(x1);
+
+            auto c1 = cc->Encrypt(keys.publicKey, ptxt1);
+
+            PrivateKey<DCRTModule> reducedKey;
+            auto rankredKey = cc->EvalRankRedKeyGen(keys.secretKey, reducedKey, newRank);
+
+            // the same key without its seed is serialized with A
+            auto fullKey = std::make_shared<EvalKeyRelinImpl<DCRTModule>>(
+                *std::dynamic_pointer_cast<EvalKeyRelinImpl<DCRTModule>>(rankredKey));
+            fullKey->SetAVectorSeed(std::vector<uint32_t>(), 0);
+
+            for (const auto& [name, key] : {std::make_pair("Compressed", rankredKey),
+                                             std::make_pair("Full", EvalKey<DCRTModule>(fullKey))}) {
+                std::stringstream s;
+                Serial::Serialize(key, s, SerType::BINARY);
+                const std::string serialized = s.str();
+
+                std::cout << "LoadAndRankRed" << name << "," << ringDim << "," << moduleRank << "," << scaleModSize
+                          << "," << multDepth << "," << newRank << "," << serialized.size() << ","
+                          << benchmark(cc, keys, ptxt1, c1, c1, std::nullopt,
+                                       [&serialized](CC cc, Keys, Plaintext, CT c1, CT, std::optional<CT>) {
+                                           std::stringstream in(serialized);
+                                           EvalKey<DCRTModule> loaded;
+                                           Serial::Deserialize(loaded, in, SerType::BINARY);
+                                           cc->EvalRankReduce(c1, loaded);
+                                       })
+                          << std::endl;
+            }
+        }
+    }
+
+    return 0;
+}
+
+// Compares BV, hybrid and single-digit GHS key switching: serialized size of the relinearization keys,
+// and the latency of Relinearize, for each module rank and depth. BV uses digits of digitSize bits.
+int runKeySwitchModes() {
+    std::cout << "operation,ringDim,rank,scaleModSize,multDepth,ksTech,dnum,bytes,iterations,ms" << std::endl;
+    uint32_t scaleModSize = 50;
+    uint32_t digitSize    = 20;
+    uint32_t ringDim      = 1024;
+
+    for (uint32_t multDepth : {2, 5}) {
+        for (uint32_t moduleRank = 2; moduleRank <= 16; moduleRank *= 2) {
+            for (KeySwitchTechnique ksTech : {BV, HYBRID, GHS}) {
+                CCParams<CryptoContextCKKSMod> parameters;
+                parameters.SetRingDim(ringDim);
+                parameters.SetSecurityLevel(HEStd_NotSet);
+                parameters.SetMultiplicativeDepth(multDepth);
+                parameters.SetScalingModSize(scaleModSize);
+                parameters.SetBatchSize(8);
+                parameters.SetModuleRank(moduleRank);
+                parameters.SetScalingTechnique(FLEXIBLEAUTOEXT);
+                parameters.SetKeySwitchTechnique(ksTech);
+                if (ksTech == BV)
+                    parameters.SetDigitSize(digitSize);
+
+                CryptoContext<DCRTModule> cc = GenCryptoContext(parameters);
+
+                cc->Enable(PKE);
+                cc->Enable(LEVELEDSHE);
+                cc->Enable(KEYSWITCH);
+
+                auto keys = cc->KeyGen();
+                cc->EvalMultModKeyGen(keys.secretKey);
+
+                size_t bytes = 0;
+                size_t dnum  = 0;
+                for (const auto& key : cc->GetEvalMultKeyVector(keys.secretKey->GetKeyTag())) {
+                    std::stringstream s;
+                    Serial::Serialize(key, s, SerType::BINARY);
+                    bytes += s.str().size();
+                    dnum = key->GetBVector().size();
                 }
+
+                std::vector<double> x1 = {0.25, 0.5, 0.75, 1.0, 2.0, 3.0, 4.0, 5.0};
+                std::vector<double> x2 = {5.0, 4.0, 3.0, 2.0, 1.0, 0.75, 0.5, 0.25};
+
+                Plaintext ptxt1 = cc->MakeCKKSPackedPlaintext(x1);
+                Plaintext ptxt2 = cc->MakeCKKSPackedPlaintext(x2);
+
+                auto c1 = cc->Encrypt(keys.publicKey, ptxt1);
+                auto c2 = cc->Encrypt(keys.publicKey, ptxt2);
+                auto c3 = cc->EvalMultNoRelin(c1, c2);
+
+                std::cout << "Relinearize," << ringDim << "," << moduleRank << "," << scaleModSize << ","
+                          << multDepth << "," << ksTech << "," << dnum << "," << bytes << ","
+                          << benchmark(cc, keys, ptxt1, c1, c2, c3,
+                                       [](CC cc, Keys, Plaintext, CT, CT, std::optional<CT> c3) {
+                                           cc->Relinearize(*c3);
+                                       })
+                          << std::endl;
             }
         }
     }
@@ -233,6 +863,12 @@ int runBaseOperations() {
 
 int main() {
     runBaseOperations();
-    // runRankRed();
+    runRankRed();
+    runRankExtend();
+    runModuleOperations();
+    runTensorProduct();
+    runParallelScaling();
+    runKeyCompression();
+    runKeySwitchModes();
     return 0;
 }
\ No newline at end of file
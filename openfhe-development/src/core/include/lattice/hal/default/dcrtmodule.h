@@ -46,8 +46,12 @@
 #include "utils/exception.h"
 #include "utils/inttypes.h"
 #include "utils/parallel.h"
+#include "utils/prng/blake2engine.h"
+#include "utils/utilities-int.h"
 
+#include <algorithm>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <utility>
@@ -73,6 +77,19 @@ public:
     using TugType                 = typename DCRTPolyInterfaceType::TugType;
     using BugType                 = typename DCRTPolyInterfaceType::BugType;
 
+    /**
+   * @brief Thread count for a parallel loop over n independent items: n, capped by the number of
+   * threads OpenMP currently allows, so SetNumThreads() and Disable() also bound the module kernels.
+   */
+    static int GetThreadLimit(size_t n) {
+#ifdef PARALLEL
+        const size_t limit = omp_get_max_threads();
+        return static_cast<int>(n > limit ? limit : n);
+#else
+        return 1;
+#endif
+    }
+
     DCRTModuleImpl() = default;
 
     DCRTModuleImpl(const std::shared_ptr<Params>& params, const Format format = Format::EVALUATION,
@@ -102,6 +119,64 @@ public:
         }
     }
 
+    /**
+   * @brief Samples count uniform modules of rows x cols entries in EVALUATION format from a BLAKE2
+   * seed, e.g. the uniform part of a seed-compressed key switching key. Every entry of every module
+   * reads its own range of the BLAKE2 counter, so the entries are sampled in parallel and the result
+   * depends only on the seed, not on the number of threads.
+   * @param seed BLAKE2 seed of at most Blake2Engine::MAX_SEED_GENS words
+   * @param count number of modules
+   * @param dcrtParams parameters of every entry
+   * @param moduleRows rows of every module
+   * @param moduleCols columns of every module
+   * @return the sampled modules
+   */
+    static std::vector<DCRTModuleType> SampleUniform(const std::vector<uint32_t>& seed, size_t count,
+                                                     const std::shared_ptr<Params>& dcrtParams, uint32_t moduleRows,
+                                                     uint32_t moduleCols) {
+        if (seed.size() > default_prng::Blake2Engine::MAX_SEED_GENS)
+            OPENFHE_THROW("The seed is longer than the BLAKE2 key");
+        default_prng::Blake2Engine::blake2_seed_array_t key{};
+        std::copy(seed.begin(), seed.end(), key.begin());
+
+        const uint32_t ringDim = dcrtParams->GetRingDimension();
+        const auto& towers     = dcrtParams->GetParams();
+
+        std::vector<DCRTModuleType> result;
+        result.reserve(count);
+        for (size_t m = 0; m < count; ++m)
+            result.emplace_back(dcrtParams, Format::EVALUATION, false, moduleRows, moduleCols);
+
+        const size_t entries = moduleRows * moduleCols;
+        const size_t size    = count * entries;
+#pragma omp parallel for num_threads(GetThreadLimit(size))
+        for (size_t n = 0; n < size; ++n) {
+            const size_t m     = n / entries;
+            const size_t entry = n % entries;
+            // 2^20 blocks of 1024 words per entry cover every tower for any supported ring dimension
+            default_prng::Blake2Engine prng(key, (static_cast<uint64_t>(m) << 40) | (static_cast<uint64_t>(entry) << 20));
+            for (size_t i = 0; i < towers.size(); ++i) {
+                const NativeInteger& modulus = towers[i]->GetModulus();
+                const uint32_t msb           = modulus.GetMSB();
+                const uint32_t words         = (msb + 31) / 32;
+                // uniform values below 2^msb, rejected until they fall below the modulus
+                NativeVector values(ringDim, modulus);
+                for (uint32_t j = 0; j < ringDim;) {
+                    NativeInteger x(0);
+                    for (uint32_t w = 0; w < words; ++w)
+                        x = (x << 32) + NativeInteger(prng());
+                    x >>= 32 * words - msb;
+                    if (x < modulus)
+                        values[j++] = x;
+                }
+                result[m]
+                    .GetElementAtIndex(entry / moduleCols, entry % moduleCols, i)
+                    .SetValues(std::move(values), Format::EVALUATION);
+            }
+        }
+        return result;
+    }
+
     DCRTModuleImpl(const BugType& bug, const std::shared_ptr<Params>& dcrtParams, Format format,
                    uint32_t moduleRows = 1, uint32_t moduleCols = 1)
         : m_params{dcrtParams}, m_format{format}, m_moduleRows{moduleRows}, m_moduleCols{moduleCols} {
@@ -126,6 +201,12 @@ public:
         m_vectors[0] = poly;
     }
 
+    DCRTModuleImpl(DCRTPolyType&& poly) noexcept
+        : m_params{poly.GetParams()}, m_format{poly.GetFormat()}, m_vectors{}, m_moduleRows{1}, m_moduleCols{1} {
+        m_vectors.resize(1);
+        m_vectors[0] = std::move(poly);
+    }
+
     DCRTModuleImpl(const DCRTModuleType& e) noexcept
         : m_params{e.m_params},
           m_format{e.m_format},
@@ -253,11 +334,13 @@ public:
      * @return -lattice
      */
     DCRTModuleType operator-() const {
-        return DCRTModuleType(m_params, m_format, true, m_moduleRows, m_moduleCols) -= *this;
+        return Negate();
     }
 
     DCRTModuleType Negate() const {
-        return DCRTModuleType(m_params, m_format, true, m_moduleRows, m_moduleCols) -= *this;
+        DCRTModuleType tmp(*this);
+        tmp.NegateInPlace();
+        return tmp;
     }
 
     /**
@@ -269,7 +352,7 @@ public:
     DCRTModuleType Plus(const Integer& element) const {
         DCRTModuleType tmp(m_params, m_format, false, m_moduleRows, m_moduleCols);
         size_t size{m_vectors.size()};
-        // #pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
+#pragma omp parallel for num_threads(GetThreadLimit(size))
         for (usint i = 0; i < size; i++) {
             tmp.m_vectors[i] = m_vectors[i] + element;
         }
@@ -285,7 +368,7 @@ public:
     DCRTModuleType Minus(const Integer& element) const {
         DCRTModuleType tmp(m_params, m_format, false, m_moduleRows, m_moduleCols);
         size_t size{m_vectors.size()};
-        // #pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
+#pragma omp parallel for num_threads(GetThreadLimit(size))
         for (usint i = 0; i < size; i++) {
             tmp.m_vectors[i] = m_vectors[i] - element;
         }
@@ -301,7 +384,7 @@ public:
     DCRTModuleType Times(const Integer& element) const {
         DCRTModuleType tmp(m_params, m_format, false, m_moduleRows, m_moduleCols);
         size_t size{m_vectors.size()};
-        // #pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
+#pragma omp parallel for num_threads(GetThreadLimit(size))
         for (usint i = 0; i < size; i++) {
             tmp.m_vectors[i] = m_vectors[i] * element;
         }
@@ -317,7 +400,7 @@ public:
     DCRTModuleType Times(const std::vector<Integer>& crtElement) const {
         DCRTModuleType tmp(m_params, m_format, false, m_moduleRows, m_moduleCols);
         size_t size{m_vectors.size()};
-        // #pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
+#pragma omp parallel for num_threads(GetThreadLimit(size))
         for (usint i = 0; i < size; i++) {
             tmp.m_vectors[i] = m_vectors[i] * crtElement;
         }
@@ -333,7 +416,7 @@ public:
     DCRTModuleType Times(NativeInteger::SignedNativeInt element) const {
         DCRTModuleType tmp(m_params, m_format, false, m_moduleRows, m_moduleCols);
         size_t size{m_vectors.size()};
-        // #pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
+#pragma omp parallel for num_threads(GetThreadLimit(size))
         for (usint i = 0; i < size; i++) {
             tmp.m_vectors[i] = m_vectors[i] * element;
         }
@@ -347,15 +430,8 @@ public:
  * @return is the result of the addition.
  */
     DCRTModuleType Plus(const DCRTModuleType& element) const {
-        if (m_moduleCols != element.m_moduleCols || m_moduleRows != element.m_moduleRows) {
-            OPENFHE_THROW("Size mismatch");
-        }
-        DCRTModuleType tmp(m_params, m_format, false, m_moduleRows, m_moduleCols);
-        size_t size{m_vectors.size()};
-        // #pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-        for (usint i = 0; i < size; i++) {
-            tmp.m_vectors[i] = m_vectors[i] + element.m_vectors[i];
-        }
+        DCRTModuleType tmp(*this);
+        tmp += element;
         return tmp;
     }
 
@@ -366,15 +442,8 @@ public:
  * @return is the result of the subtraction.
  */
     DCRTModuleType Minus(const DCRTModuleType& element) const {
-        if (m_moduleCols != element.m_moduleCols || m_moduleRows != element.m_moduleRows) {
-            OPENFHE_THROW("Size mismatch");
-        }
-        DCRTModuleType tmp(m_params, m_format, false, m_moduleRows, m_moduleCols);
-        size_t size{m_vectors.size()};
-        // #pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-        for (usint i = 0; i < size; i++) {
-            tmp.m_vectors[i] = m_vectors[i] - element.m_vectors[i];
-        }
+        DCRTModuleType tmp(*this);
+        tmp -= element;
         return tmp;
     }
 
@@ -387,14 +456,18 @@ public:
     DCRTModuleType Times(const DCRTModuleType& element) const {
         if (m_moduleRows == 1 && m_moduleCols == 1) {
             DCRTModuleType tmp(m_params, m_format, false, element.m_moduleRows, element.m_moduleCols);
-            for (usint i = 0; i < element.m_vectors.size(); i++) {
+            size_t size{element.m_vectors.size()};
+#pragma omp parallel for num_threads(GetThreadLimit(size))
+            for (usint i = 0; i < size; i++) {
                 tmp.m_vectors[i] = m_vectors[0] * element.m_vectors[i];
             }
             return tmp;
         }
         else if (element.m_moduleRows == 1 && element.m_moduleCols == 1) {
             DCRTModuleType tmp(m_params, m_format, false, m_moduleRows, m_moduleCols);
-            for (usint i = 0; i < m_vectors.size(); i++) {
+            size_t size{m_vectors.size()};
+#pragma omp parallel for num_threads(GetThreadLimit(size))
+            for (usint i = 0; i < size; i++) {
                 tmp.m_vectors[i] = m_vectors[i] * element.m_vectors[0];
             }
             return tmp;
@@ -404,16 +477,23 @@ public:
             OPENFHE_THROW("Times size mismatch");
         }
 
-        DCRTModuleType tmp(m_params, m_format, true, m_moduleRows, element.m_moduleCols);
-        // #pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(tmp.m_moduleRows))
-        for (usint row = 0; row < tmp.m_moduleRows; row++) {
-            for (usint col = 0; col < tmp.m_moduleCols; col++) {
-                for (usint i = 0; i < m_moduleCols; i++) {
-                    tmp.m_vectors[row * tmp.m_moduleCols + col] +=
-                        m_vectors[row * m_moduleCols + i] * element.m_vectors[i * element.m_moduleCols + col];
+        if (m_format != Format::EVALUATION || element.m_format != Format::EVALUATION) {
+            DCRTModuleType tmp(m_params, m_format, true, m_moduleRows, element.m_moduleCols);
+            for (usint row = 0; row < tmp.m_moduleRows; row++) {
+                for (usint col = 0; col < tmp.m_moduleCols; col++) {
+                    for (usint i = 0; i < m_moduleCols; i++) {
+                        tmp.m_vectors[row * tmp.m_moduleCols + col] +=
+                            m_vectors[row * m_moduleCols + i] * element.m_vectors[i * element.m_moduleCols + col];
+                    }
                 }
             }
+            return tmp;
         }
+
+        // Every output coefficient is accumulated over the inner dimension and, with 128-bit
+        // integers, reduced once instead of once per term; loops run tower-major.
+        DCRTModuleType tmp(m_params, m_format, true, m_moduleRows, element.m_moduleCols);
+        tmp.MultiplyAccumulateInPlace(*this, element, false);
         return tmp;
     }
 
@@ -422,8 +502,20 @@ public:
             OPENFHE_THROW("HadamardProduct size mismatch");
         }
         DCRTModuleType tmp(m_params, m_format, false, m_moduleRows, m_moduleCols);
-        for (usint i = 0; i < m_vectors.size(); i++) {
-            tmp.m_vectors[i] = m_vectors[i] * element.m_vectors[i];
+        if (m_format != Format::EVALUATION || element.m_format != Format::EVALUATION) {
+            for (usint i = 0; i < m_vectors.size(); i++) {
+                tmp.m_vectors[i] = m_vectors[i] * element.m_vectors[i];
+            }
+            return tmp;
+        }
+        const size_t entries{m_vectors.size()};
+        const size_t size{GetNumOfElements() * entries};
+#pragma omp parallel for num_threads(GetThreadLimit(size))
+        for (size_t j = 0; j < size; ++j) {
+            const size_t t{j / entries};
+            const size_t i{j % entries};
+            tmp.m_vectors[i].GetAllElements()[t] =
+                m_vectors[i].GetElementAtIndex(t).TimesNoCheck(element.m_vectors[i].GetElementAtIndex(t));
         }
         return tmp;
     }
@@ -440,15 +532,313 @@ public:
             cols = m_moduleCols * (m_moduleCols - 1) / 2;
         }
         DCRTModuleType tmp(m_params, m_format, false, rows, cols);
-        int k = 0;
+        std::vector<std::pair<usint, usint>> pairs;
+        pairs.reserve(tmp.m_vectors.size());
         for (usint i = 0; i < m_vectors.size(); i++) {
             for (usint j = i + 1; j < m_vectors.size(); j++) {
-                tmp.m_vectors[k++] = m_vectors[i] * element.m_vectors[j];
+                pairs.emplace_back(i, j);
             }
         }
+        size_t size{pairs.size()};
+#pragma omp parallel for num_threads(GetThreadLimit(size))
+        for (size_t k = 0; k < size; ++k) {
+            tmp.m_vectors[k] = m_vectors[pairs[k].first] * element.m_vectors[pairs[k].second];
+        }
         return tmp;
     }
 
+    /**
+ * @brief Computes the diagonal and the strict lower triangle of the outer product of this
+ * and element in one pass. The diagonal is this (.) element. The lower triangle holds, for
+ * i < j in the order of LowerTriangleProduct, this_i * element_j + this_j * element_i when
+ * symmetrize is true and this_i * element_j otherwise. When element is this module, each
+ * cross product is computed only once.
+ *
+ * @param &element is the second operand, of the same vector shape as this.
+ * @param &diagonal receives the diagonal, of the shape of this.
+ * @param &lowerTriangle receives the lower triangle, of the shape returned by LowerTriangleProduct.
+ * @param symmetrize selects the symmetric sum for the lower triangle.
+ */
+    void SymmetricOuterProduct(const DCRTModuleType& element, DCRTModuleType& diagonal,
+                               DCRTModuleType& lowerTriangle, bool symmetrize = true) const {
+        if ((m_moduleCols != 1 && m_moduleRows != 1) || m_moduleRows != element.m_moduleRows ||
+            m_moduleCols != element.m_moduleCols) {
+            OPENFHE_THROW("SymmetricOuterProduct size mismatch");
+        }
+        if (m_format != Format::EVALUATION || element.m_format != Format::EVALUATION) {
+            OPENFHE_THROW("SymmetricOuterProduct supported only in Format::EVALUATION");
+        }
+        const usint n = m_vectors.size();
+
+        diagonal = DCRTModuleType(m_params, m_format, false, m_moduleRows, m_moduleCols);
+        if (m_moduleRows == 1)
+            lowerTriangle = DCRTModuleType(m_params, m_format, false, 1, n * (n - 1) / 2);
+        else
+            lowerTriangle = DCRTModuleType(m_params, m_format, false, n * (n - 1) / 2, 1);
+
+        // items [0, n) are the diagonal, the remaining ones the pairs i < j
+        std::vector<const DCRTPolyType*> lhs(n);
+        std::vector<const DCRTPolyType*> rhs(n);
+        std::vector<std::pair<usint, usint>> items;
+        std::vector<DCRTPolyType*> outputs;
+        items.reserve(n * (n + 1) / 2);
+        outputs.reserve(n * (n + 1) / 2);
+        for (usint i = 0; i < n; i++) {
+            lhs[i] = &m_vectors[i];
+            rhs[i] = &element.m_vectors[i];
+            items.emplace_back(i, i);
+            outputs.push_back(&diagonal.m_vectors[i]);
+        }
+        for (usint i = 0, k = 0; i < n; i++) {
+            for (usint j = i + 1; j < n; j++, k++) {
+                items.emplace_back(i, j);
+                outputs.push_back(&lowerTriangle.m_vectors[k]);
+            }
+        }
+
+        PairProducts(lhs, rhs, items, outputs, GetNumOfElements(), symmetrize, &element == this);
+    }
+
+    /**
+ * @brief Computes the tensor product of the vectors (x0, this) and (y0, element), as needed for
+ * the product of two ciphertexts, in one parallel pass over all towers and products: the
+ * constant term x0 * y0, the linear terms x0 * element_i + this_i * y0, and the diagonal and lower
+ * triangle of SymmetricOuterProduct. The two products of a cross term share one modular
+ * reduction. When element is this and y0 is x0, each cross product is computed once and doubled.
+ *
+ * @param &x0 is the 1x1 first entry of the first vector.
+ * @param &element is the second operand, of the same vector shape as this.
+ * @param &y0 is the 1x1 first entry of the second vector.
+ * @param &constant receives x0 * y0.
+ * @param &linear receives the linear terms, of the shape of this.
+ * @param &diagonal receives the diagonal, of the shape of this.
+ * @param &lowerTriangle receives the lower triangle; it is left as it is when this has one entry.
+ */
+    void TensorProduct(const DCRTModuleType& x0, const DCRTModuleType& element, const DCRTModuleType& y0,
+                       DCRTModuleType& constant, DCRTModuleType& linear, DCRTModuleType& diagonal,
+                       DCRTModuleType& lowerTriangle) const {
+        if ((m_moduleCols != 1 && m_moduleRows != 1) || m_moduleRows != element.m_moduleRows ||
+            m_moduleCols != element.m_moduleCols || x0.m_vectors.size() != 1 || y0.m_vectors.size() != 1) {
+            OPENFHE_THROW("TensorProduct size mismatch");
+        }
+        if (m_format != Format::EVALUATION || element.m_format != Format::EVALUATION ||
+            x0.m_format != Format::EVALUATION || y0.m_format != Format::EVALUATION) {
+            OPENFHE_THROW("TensorProduct supported only in Format::EVALUATION");
+        }
+        const usint n = m_vectors.size();
+        const usint numTowers{GetNumOfElements()};
+        if (element.GetNumOfElements() < numTowers || x0.GetNumOfElements() < numTowers ||
+            y0.GetNumOfElements() < numTowers) {
+            OPENFHE_THROW("TensorProduct requires operands with at least as many towers as this");
+        }
+
+        constant = DCRTModuleType(m_params, m_format, false);
+        linear   = DCRTModuleType(m_params, m_format, false, m_moduleRows, m_moduleCols);
+        diagonal = DCRTModuleType(m_params, m_format, false, m_moduleRows, m_moduleCols);
+        if (n > 1) {
+            if (m_moduleRows == 1)
+                lowerTriangle = DCRTModuleType(m_params, m_format, false, 1, n * (n - 1) / 2);
+            else
+                lowerTriangle = DCRTModuleType(m_params, m_format, false, n * (n - 1) / 2, 1);
+        }
+
+        // entry 0 of the operands is x0 and y0, entries [1, n] are this and element
+        std::vector<const DCRTPolyType*> lhs(n + 1);
+        std::vector<const DCRTPolyType*> rhs(n + 1);
+        lhs[0] = &x0.m_vectors[0];
+        rhs[0] = &y0.m_vectors[0];
+        for (usint i = 0; i < n; i++) {
+            lhs[i + 1] = &m_vectors[i];
+            rhs[i + 1] = &element.m_vectors[i];
+        }
+
+        std::vector<std::pair<usint, usint>> items;
+        std::vector<DCRTPolyType*> outputs;
+        items.reserve((n + 1) * (n + 2) / 2);
+        outputs.reserve((n + 1) * (n + 2) / 2);
+        items.emplace_back(0, 0);
+        outputs.push_back(&constant.m_vectors[0]);
+        for (usint i = 1; i <= n; i++) {
+            items.emplace_back(0, i);
+            outputs.push_back(&linear.m_vectors[i - 1]);
+        }
+        for (usint i = 1; i <= n; i++) {
+            items.emplace_back(i, i);
+            outputs.push_back(&diagonal.m_vectors[i - 1]);
+        }
+        for (usint i = 1, k = 0; i <= n; i++) {
+            for (usint j = i + 1; j <= n; j++, k++) {
+                items.emplace_back(i, j);
+                outputs.push_back(&lowerTriangle.m_vectors[k]);
+            }
+        }
+
+        PairProducts(lhs, rhs, items, outputs, numTowers, true, &element == this && &y0 == &x0);
+    }
+
+    // in-place fused operations; none of them allocates coefficient storage
+
+    /**
+ * @brief Negates every entry in place.
+ */
+    void NegateInPlace() {
+        const NativeInteger zero(0);
+        const size_t entries{m_vectors.size()};
+        const size_t size{GetNumOfElements() * entries};
+#pragma omp parallel for num_threads(GetThreadLimit(size))
+        for (size_t j = 0; j < size; ++j) {
+            auto& poly = m_vectors[j % entries].GetAllElements()[j / entries];
+            const NativeInteger& q{poly.GetModulus()};
+            const uint32_t ringDim{poly.GetRingDimension()};
+            for (uint32_t ri = 0; ri < ringDim; ++ri)
+                poly[ri] = zero.ModSubFast(poly[ri], q);
+        }
+    }
+
+    /**
+ * @brief Computes this += a * b (module matrix product, 1x1 operands are broadcast)
+ * with one modular reduction per output coefficient.
+ * a and b may carry more towers than this; only the towers of this are used.
+ *
+ * @param &a is the left operand.
+ * @param &b is the right operand.
+ */
+    void MultiplyAddInPlace(const DCRTModuleType& a, const DCRTModuleType& b) {
+        MultiplyAccumulateInPlace(a, b, false);
+    }
+
+    /**
+ * @brief Computes this -= a * b (module matrix product, 1x1 operands are broadcast)
+ * with one modular reduction per output coefficient.
+ * a and b may carry more towers than this; only the towers of this are used.
+ *
+ * @param &a is the left operand.
+ * @param &b is the right operand.
+ */
+    void MultiplySubtractInPlace(const DCRTModuleType& a, const DCRTModuleType& b) {
+        MultiplyAccumulateInPlace(a, b, true);
+    }
+
+    /**
+ * @brief Computes this += a (.) b, the entry-wise product, with one modular
+ * reduction per output coefficient.
+ *
+ * @param &a is the left operand.
+ * @param &b is the right operand.
+ */
+    void HadamardProductAddInPlace(const DCRTModuleType& a, const DCRTModuleType& b) {
+        if (a.m_moduleRows != m_moduleRows || a.m_moduleCols != m_moduleCols || b.m_moduleRows != m_moduleRows ||
+            b.m_moduleCols != m_moduleCols) {
+            OPENFHE_THROW("HadamardProductAddInPlace size mismatch");
+        }
+        AccumulateProducts(a, b, 1, false, [](size_t e, usint) { return std::make_pair(e, e); });
+    }
+
+    /**
+ * @brief Computes this += c * x, where c is a constant given by its CRT residues.
+ * Towers whose residue is zero, or which x does not have, are left untouched.
+ *
+ * @param &x is the module to scale.
+ * @param &crtConstant holds the residues of the constant, one per tower of this.
+ */
+    void ScaleAndAddInPlace(const DCRTModuleType& x, const std::vector<NativeInteger>& crtConstant) {
+        if (x.m_moduleRows != m_moduleRows || x.m_moduleCols != m_moduleCols) {
+            OPENFHE_THROW("ScaleAndAddInPlace size mismatch");
+        }
+        if (m_format != x.m_format) {
+            OPENFHE_THROW("ScaleAndAddInPlace format mismatch");
+        }
+        const size_t entries{m_vectors.size()};
+        const size_t towers{std::min<size_t>(std::min<size_t>(GetNumOfElements(), x.GetNumOfElements()),
+                                             crtConstant.size())};
+        const size_t size{towers * entries};
+#pragma omp parallel for num_threads(GetThreadLimit(size))
+        for (size_t j = 0; j < size; ++j) {
+            const size_t t{j / entries};
+            if (crtConstant[t] == NativeInteger(0))
+                continue;
+            auto& poly = m_vectors[j % entries].GetAllElements()[t];
+            const auto& xv{x.m_vectors[j % entries].GetElementAtIndex(t).GetValues()};
+            const NativeInteger& q{poly.GetModulus()};
+            const NativeInteger c{crtConstant[t].Mod(q)};
+            const NativeInteger cPrecon{c.PrepModMulConst(q)};
+            const uint32_t ringDim{poly.GetRingDimension()};
+            for (uint32_t ri = 0; ri < ringDim; ++ri)
+                poly[ri].ModAddFastEq(xv[ri].ModMulFastConst(c, q, cPrecon), q);
+        }
+    }
+
+    /**
+ * @brief Adds a constant, given by its CRT residues, to every entry in place.
+ *
+ * @param &crtConstant holds the residues of the constant, at least one per tower of this.
+ */
+    void AddConstantInPlace(const std::vector<Integer>& crtConstant) {
+        if (m_format != Format::EVALUATION) {
+            OPENFHE_THROW("AddConstantInPlace supported only in Format::EVALUATION");
+        }
+        ConstantInPlace(crtConstant, [](NativeInteger& x, const NativeInteger& c, const NativeInteger&,
+                                        const NativeInteger& q) { x.ModAddFastEq(c, q); });
+    }
+
+    /**
+ * @brief Subtracts a constant, given by its CRT residues, from every entry in place.
+ *
+ * @param &crtConstant holds the residues of the constant, at least one per tower of this.
+ */
+    void SubtractConstantInPlace(const std::vector<Integer>& crtConstant) {
+        if (m_format != Format::EVALUATION) {
+            OPENFHE_THROW("SubtractConstantInPlace supported only in Format::EVALUATION");
+        }
+        ConstantInPlace(crtConstant, [](NativeInteger& x, const NativeInteger& c, const NativeInteger&,
+                                        const NativeInteger& q) { x.ModSubFastEq(c, q); });
+    }
+
+    /**
+ * @brief Multiplies every entry by a constant, given by its CRT residues, in place.
+ *
+ * @param &crtConstant holds the residues of the constant, at least one per tower of this.
+ */
+    void MultiplyConstantInPlace(const std::vector<Integer>& crtConstant) {
+        ConstantInPlace(crtConstant, [](NativeInteger& x, const NativeInteger& c, const NativeInteger& cPrecon,
+                                        const NativeInteger& q) { x.ModMulFastConstEq(c, q, cPrecon); });
+    }
+
+    /**
+ * @brief Multiplies every entry by poly, which is broadcast across the module.
+ * poly may carry more towers than this; only the towers of this are used, so a
+ * polynomial encoded at a higher level is neither copied nor truncated.
+ *
+ * @param &poly is the multiplier.
+ */
+    void MultiplyByPolyInPlace(const DCRTPolyType& poly) {
+        if (m_format != Format::EVALUATION) {
+            OPENFHE_THROW("MultiplyByPolyInPlace supported only in Format::EVALUATION");
+        }
+        BroadcastPolyInPlace(poly, [](NativeInteger& x, const NativeInteger& y, const NativeInteger& q,
+                                      const NativeInteger& mu) { x.ModMulFastEq(y, q, mu); });
+    }
+
+    /**
+ * @brief Adds poly to every entry; towers of poly beyond those of this are ignored.
+ *
+ * @param &poly is the polynomial to add.
+ */
+    void AddPolyInPlace(const DCRTPolyType& poly) {
+        BroadcastPolyInPlace(poly, [](NativeInteger& x, const NativeInteger& y, const NativeInteger& q,
+                                      const NativeInteger&) { x.ModAddFastEq(y, q); });
+    }
+
+    /**
+ * @brief Subtracts poly from every entry; towers of poly beyond those of this are ignored.
+ *
+ * @param &poly is the polynomial to subtract.
+ */
+    void SubtractPolyInPlace(const DCRTPolyType& poly) {
+        BroadcastPolyInPlace(poly, [](NativeInteger& x, const NativeInteger& y, const NativeInteger& q,
+                                      const NativeInteger&) { x.ModSubFastEq(y, q); });
+    }
+
     // overloaded op= operators
     /**
  * @brief Performs += operation with a Integer and returns the result.
@@ -458,7 +848,7 @@ public:
  */
     const DCRTModuleType& operator+=(const Integer& element) {
         size_t size{m_vectors.size()};
-        // #pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
+#pragma omp parallel for num_threads(GetThreadLimit(size))
         for (usint i = 0; i < size; i++) {
             m_vectors[i] += element;
         }
@@ -473,7 +863,7 @@ public:
  */
     const DCRTModuleType& operator-=(const Integer& element) {
         size_t size{m_vectors.size()};
-        // #pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
+#pragma omp parallel for num_threads(GetThreadLimit(size))
         for (usint i = 0; i < size; i++) {
             m_vectors[i] -= element;
         }
@@ -488,7 +878,7 @@ public:
  */
     const DCRTModuleType& operator*=(const Integer& element) {
         size_t size{m_vectors.size()};
-        // #pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
+#pragma omp parallel for num_threads(GetThreadLimit(size))
         for (usint i = 0; i < size; i++) {
             m_vectors[i] *= element;
         }
@@ -506,7 +896,7 @@ public:
             OPENFHE_THROW("Size mismatch");
         }
         size_t size{m_vectors.size()};
-        // #pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
+#pragma omp parallel for num_threads(GetThreadLimit(size))
         for (usint i = 0; i < size; i++) {
             m_vectors[i] += element.m_vectors[i];
         }
@@ -524,7 +914,7 @@ public:
             OPENFHE_THROW("Size mismatch");
         }
         size_t size{m_vectors.size()};
-        // #pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
+#pragma omp parallel for num_threads(GetThreadLimit(size))
         for (usint i = 0; i < size; i++) {
             m_vectors[i] -= element.m_vectors[i];
         }
@@ -546,8 +936,11 @@ public:
  * @param element the element to compare to.
  */
     bool operator==(const DCRTModuleType& rhs) const {
-        return ((m_format == rhs.m_format) && (m_params->GetCyclotomicOrder() == rhs.m_params->GetCyclotomicOrder()) &&
-                (m_params->GetModulus() == rhs.m_params->GetModulus()) && (m_vectors.size() == rhs.m_vectors.size()) &&
+        return ((m_format == rhs.m_format) &&
+                (m_params == rhs.m_params ||
+                 ((m_params->GetCyclotomicOrder() == rhs.m_params->GetCyclotomicOrder()) &&
+                  (m_params->GetModulus() == rhs.m_params->GetModulus()))) &&
+                (m_vectors.size() == rhs.m_vectors.size()) &&
                 (m_vectors == rhs.m_vectors) && (m_moduleCols == rhs.m_moduleCols));
     }
 
@@ -563,38 +956,56 @@ public:
  * @brief Adds one to every entry of the Element, in place
  */
     void AddILElementOne() {
-        size_t size{m_vectors.size()};
-        // #pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-        for (usint i = 0; i < size; i++) {
-            m_vectors[i].AddILElementOne();
-        }
+        if (m_format != Format::EVALUATION)
+            OPENFHE_THROW("AddILElementOne supported only in Format::EVALUATION");
+        const size_t entries{m_vectors.size()};
+        const size_t size{GetNumOfElements() * entries};
+#pragma omp parallel for num_threads(GetThreadLimit(size))
+        for (size_t j = 0; j < size; ++j)
+            m_vectors[j % entries].GetAllElements()[j / entries].AddILElementOne();
     }
 
     void DropLastElement() {
-        for (auto& v : m_vectors)
-            v.DropLastElement();
-        Params* newP = new Params(*m_params);
-        newP->PopLastParam();
-        m_params.reset(newP);
+        DropLastElements(1);
     }
 
     void DropLastElements(size_t i) {
-        for (auto& v : m_vectors)
-            v.DropLastElements(i);
-        Params* newP = new Params(*m_params);
+        // one parameter set is shared by all entries
+        auto newP = std::make_shared<Params>(*m_params);
         for (size_t j = 0; j < i; ++j)
             newP->PopLastParam();
-        m_params.reset(newP);
+        DropLastElements(i, newP);
+    }
+
+    /**
+ * @brief Drops the last i towers of every entry and shares paramsQl, which must
+ * describe the remaining towers, so no parameter set is allocated.
+ *
+ * @param i is the number of towers to drop.
+ * @param &paramsQl are the parameters of the remaining towers.
+ */
+    void DropLastElements(size_t i, const std::shared_ptr<Params>& paramsQl) {
+        for (auto& v : m_vectors)
+            v.DropLastElements(i, paramsQl);
+        m_params = paramsQl;
     }
 
     // used for CKKS rescaling
     void DropLastElementAndScale(const std::vector<NativeInteger>& QlQlInvModqlDivqlModq,
                                  const std::vector<NativeInteger>& qlInvModq) {
-        for (auto& v : m_vectors)
-            v.DropLastElementAndScale(QlQlInvModqlDivqlModq, qlInvModq);
-        Params* newP = new Params(*m_params);
+        auto newP = std::make_shared<Params>(*m_params);
         newP->PopLastParam();
-        m_params.reset(newP);
+        DropLastElementAndScale(QlQlInvModqlDivqlModq, qlInvModq, newP);
+    }
+
+    /**
+ * @brief Same as DropLastElementAndScale, sharing paramsQl for the remaining towers.
+ */
+    void DropLastElementAndScale(const std::vector<NativeInteger>& QlQlInvModqlDivqlModq,
+                                 const std::vector<NativeInteger>& qlInvModq, const std::shared_ptr<Params>& paramsQl) {
+        for (auto& v : m_vectors)
+            v.DropLastElementAndScale(QlQlInvModqlDivqlModq, qlInvModq, paramsQl);
+        m_params = paramsQl;
     }
 
     usint GetNumOfElements() const {
@@ -602,25 +1013,44 @@ public:
     }
 
     /**
- * @brief Performs an automorphism transform operation and returns the result.
+ * @brief Performs an automorphism transform operation on every entry and returns the result.
  *
  * @param &i is the element to perform the automorphism transform with.
  * @return is the result of the automorphism transform.
  */
     DCRTModuleType AutomorphismTransform(uint32_t i) const {
-        OPENFHE_THROW("AutomorphismTransform not implemented");
+        DCRTModuleType tmp(m_params, m_format, false, m_moduleRows, m_moduleCols);
+        const size_t numTowers{GetNumOfElements()};
+        const size_t size{m_vectors.size() * numTowers};
+#pragma omp parallel for num_threads(GetThreadLimit(size))
+        for (size_t k = 0; k < size; ++k) {
+            const size_t entry{k / numTowers};
+            const size_t t{k % numTowers};
+            tmp.m_vectors[entry].GetAllElements()[t] = m_vectors[entry].GetElementAtIndex(t).AutomorphismTransform(i);
+        }
+        return tmp;
     }
 
     /**
- * @brief Performs an automorphism transform operation using precomputed bit
- * reversal indices.
+ * @brief Performs an automorphism transform operation on every entry using precomputed
+ * bit reversal indices.
  *
  * @param &i is the element to perform the automorphism transform with.
  * @param &vec a vector with precomputed indices
  * @return is the result of the automorphism transform.
  */
     DCRTModuleType AutomorphismTransform(uint32_t i, const std::vector<uint32_t>& vec) const {
-        OPENFHE_THROW("AutomorphismTransform not implemented");
+        DCRTModuleType tmp(m_params, m_format, false, m_moduleRows, m_moduleCols);
+        const size_t numTowers{GetNumOfElements()};
+        const size_t size{m_vectors.size() * numTowers};
+#pragma omp parallel for num_threads(GetThreadLimit(size))
+        for (size_t k = 0; k < size; ++k) {
+            const size_t entry{k / numTowers};
+            const size_t t{k % numTowers};
+            tmp.m_vectors[entry].GetAllElements()[t] =
+                m_vectors[entry].GetElementAtIndex(t).AutomorphismTransform(i, vec);
+        }
+        return tmp;
     }
 
     /**
@@ -645,7 +1075,21 @@ public:
  * @result is the pointer where the base decomposition vector is stored
  */
     std::vector<DCRTModuleType> BaseDecompose(usint baseBits, bool evalModeAnswer) const {
-        OPENFHE_THROW("BaseDecompose not implemented");
+        return DecomposeEntries([baseBits, evalModeAnswer](const DCRTPolyType& poly) {
+            return poly.BaseDecompose(baseBits, evalModeAnswer);
+        });
+    }
+
+    /**
+ * @brief Decomposes every entry into its CRT digits as DCRTPoly::CRTDecompose does:
+ * the residue of each tower (or each baseBits window of it) is lifted to all towers.
+ * This is the digit decomposition used by BV key switching.
+ *
+ * @param baseBits is the number of bits of a window; 0 uses whole towers as digits
+ * @return the digits, each with the shape of this module, in Format::EVALUATION
+ */
+    std::vector<DCRTModuleType> CRTDecompose(uint32_t baseBits) const {
+        return DecomposeEntries([baseBits](const DCRTPolyType& poly) { return poly.CRTDecompose(baseBits); });
     }
 
     /**
@@ -658,7 +1102,7 @@ public:
     DCRTModuleType DivideAndRound(const Integer& q) const {
         DCRTModuleType tmp(m_params, m_format, false, m_moduleRows, m_moduleCols);
         size_t size{m_vectors.size()};
-        // #pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
+#pragma omp parallel for num_threads(GetThreadLimit(size))
         for (usint i = 0; i < size; i++) {
             tmp.m_vectors[i] = m_vectors[i].DivideAndRound(q);
         }
@@ -672,13 +1116,43 @@ public:
         const std::vector<std::vector<NativeInteger>>& PHatModq, const std::vector<DoubleNativeInt>& modqBarrettMu,
         const std::vector<NativeInteger>& tInvModp, const std::vector<NativeInteger>& tInvModpPrecon,
         const NativeInteger& t, const std::vector<NativeInteger>& tModqPrecon) const {
-        DCRTModuleType tmp(m_params, m_format, false, m_moduleRows, m_moduleCols);
-        size_t size{m_vectors.size()};
-        // #pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-        for (usint i = 0; i < size; i++) {
-            tmp.m_vectors[i] =
-                m_vectors[i].ApproxModDown(paramsQ, paramsP, PInvModq, PInvModqPrecon, PHatInvModp, PHatInvModpPrecon,
-                                           PHatModq, modqBarrettMu, tInvModp, tInvModpPrecon, t, tModqPrecon);
+        const size_t entries{m_vectors.size()};
+        const size_t sizeP{paramsP->GetParams().size()};
+        const size_t sizeQ{GetNumOfElements() - sizeP};
+        if (paramsQ->GetParams().size() != sizeQ)
+            OPENFHE_THROW("ApproxModDown: paramsQ must have as many towers as this module has outside P");
+
+        // Same steps as DCRTPoly::ApproxModDown, each one a single parallel loop over the
+        // (tower, entry) pairs of the whole module
+        DCRTModuleType partP(paramsP, Format::COEFFICIENT, false, m_moduleRows, m_moduleCols);
+        size_t size{sizeP * entries};
+#pragma omp parallel for num_threads(GetThreadLimit(size))
+        for (size_t k = 0; k < size; ++k) {
+            const size_t j{k / entries};
+            auto& pj{partP.m_vectors[k % entries].GetAllElements()[j]};
+            pj = m_vectors[k % entries].GetElementAtIndex(sizeQ + j);
+            pj.SetFormat(Format::COEFFICIENT);
+            // Multiply everything by -t^(-1) mod P (BGVrns only)
+            if (t > 0)
+                pj *= tInvModp[j];
+        }
+
+        auto partPSwitchedToQ =
+            partP.ApproxSwitchCRTBasis(paramsP, paramsQ, PHatInvModp, PHatInvModpPrecon, PHatModq, modqBarrettMu);
+
+        // the result lives in basis Q, so it must not keep the parameters of Q*P
+        DCRTModuleType tmp(paramsQ, Format::EVALUATION, false, m_moduleRows, m_moduleCols);
+        size = sizeQ * entries;
+#pragma omp parallel for num_threads(GetThreadLimit(size))
+        for (size_t k = 0; k < size; ++k) {
+            const size_t i{k / entries};
+            auto& switched{partPSwitchedToQ.m_vectors[k % entries].GetAllElements()[i]};
+            // Multiply everything by t mod Q (BGVrns only)
+            if (t > 0)
+                switched *= t;
+            switched.SetFormat(Format::EVALUATION);
+            tmp.m_vectors[k % entries].GetAllElements()[i] =
+                (m_vectors[k % entries].GetElementAtIndex(i) - switched) * PInvModq[i];
         }
         return tmp;
     }
@@ -752,7 +1226,7 @@ public:
     DCRTModuleType MultiplyAndRound(const Integer& p, const Integer& q) const {
         DCRTModuleType tmp(m_params, m_format, false, m_moduleRows, m_moduleCols);
         size_t size{m_vectors.size()};
-        // #pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
+#pragma omp parallel for num_threads(GetThreadLimit(size))
         for (usint i = 0; i < size; i++) {
             tmp.m_vectors[i] = m_vectors[i].MultiplyAndRound(p, q);
         }
@@ -767,7 +1241,7 @@ public:
  * @return
  */
     std::vector<DCRTModuleType> PowersOfBase(usint baseBits) const {
-        OPENFHE_THROW("PowersOfBase not implemented");
+        return DecomposeEntries([baseBits](const DCRTPolyType& poly) { return poly.PowersOfBase(baseBits); });
     }
 
     /**
@@ -780,7 +1254,7 @@ public:
     DCRTModuleType Mod(const Integer& modulus) const {
         DCRTModuleType tmp(m_params, m_format, false, m_moduleRows, m_moduleCols);
         size_t size{m_vectors.size()};
-        // #pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
+#pragma omp parallel for num_threads(GetThreadLimit(size))
         for (usint i = 0; i < size; i++) {
             tmp.m_vectors[i] = m_vectors[i].Mod(modulus);
         }
@@ -791,48 +1265,131 @@ public:
         return m_vectors[index];
     }
 
-    DCRTModuleType DropRows(uint32_t rowsToDrop, DCRTModuleType& removed) const {
-        if (rowsToDrop >= m_moduleRows) {
-            OPENFHE_THROW("DropRows rows to drop is >= current rows");
-        }
+    void SetDCRTPolyAt(uint32_t index, DCRTPolyType&& poly) {
+        m_vectors[index] = std::move(poly);
+    }
 
-        DCRTModuleType reduced(m_params, m_format, false, m_moduleRows - rowsToDrop, m_moduleCols);
-        for (usint row = 0; row < m_moduleRows - rowsToDrop; row++) {
-            for (usint col = 0; col < m_moduleCols; col++) {
-                reduced.m_vectors[row * m_moduleCols + col] = m_vectors[row * m_moduleCols + col];
-            }
-        }
+    /**
+ * @brief Moves the entry at index out of the module without copying its towers.
+ * The entry left behind is empty and must be set again before the module is used.
+ */
+    DCRTPolyType ReleaseDCRTPolyAt(uint32_t index) {
+        return std::move(m_vectors[index]);
+    }
 
-        removed = DCRTModuleType(m_params, m_format, false, rowsToDrop, m_moduleCols);
-        for (usint row = 0; row < rowsToDrop; row++) {
-            for (usint col = 0; col < m_moduleCols; col++) {
-                removed.m_vectors[row * m_moduleCols + col] =
-                    m_vectors[(m_moduleRows - rowsToDrop + row) * m_moduleCols + col];
-            }
-        }
+    /**
+ * @brief Returns the first rows in reduced and the last rowsToDrop rows in removed.
+ * Both results are copies; use SplitRows to avoid copying coefficient data.
+ */
+    DCRTModuleType DropRows(uint32_t rowsToDrop, DCRTModuleType& removed) const {
+        DCRTModuleType reduced(*this);
+        removed = reduced.SplitRows(rowsToDrop);
         return reduced;
     }
 
+    /**
+ * @brief Returns the first columns in reduced and the last columnsToDrop columns in removed.
+ * Both results are copies; use SplitColumns to avoid copying coefficient data.
+ */
     DCRTModuleType DropColumns(uint32_t columnsToDrop, DCRTModuleType& removed) const {
-        if (columnsToDrop >= m_moduleCols) {
-            OPENFHE_THROW("DropRows rows to drop is >= current rows");
+        DCRTModuleType reduced(*this);
+        removed = reduced.SplitColumns(columnsToDrop);
+        return reduced;
+    }
+
+    /**
+ * @brief Moves the last rowsToSplit rows out of this module and returns them.
+ * The polynomials are moved, not copied; this keeps the first rows.
+ *
+ * @param rowsToSplit is the number of trailing rows to move out.
+ * @return the module holding the removed rows.
+ */
+    DCRTModuleType SplitRows(uint32_t rowsToSplit) {
+        if (rowsToSplit >= m_moduleRows) {
+            OPENFHE_THROW("SplitRows rows to split is >= current rows");
         }
+        const uint32_t keptRows{m_moduleRows - rowsToSplit};
 
-        DCRTModuleType reduced(m_params, m_format, false, m_moduleRows, m_moduleCols - columnsToDrop);
+        DCRTModuleType removed;
+        removed.m_params     = m_params;
+        removed.m_format     = m_format;
+        removed.m_moduleRows = rowsToSplit;
+        removed.m_moduleCols = m_moduleCols;
+        removed.m_vectors.reserve(rowsToSplit * m_moduleCols);
+        auto first = m_vectors.begin() + keptRows * m_moduleCols;
+        std::move(first, m_vectors.end(), std::back_inserter(removed.m_vectors));
+        m_vectors.erase(first, m_vectors.end());
+        m_moduleRows = keptRows;
+        return removed;
+    }
+
+    /**
+ * @brief Moves the last columnsToSplit columns out of this module and returns them.
+ * The polynomials are moved, not copied; this keeps the first columns.
+ *
+ * @param columnsToSplit is the number of trailing columns to move out.
+ * @return the module holding the removed columns.
+ */
+    DCRTModuleType SplitColumns(uint32_t columnsToSplit) {
+        if (columnsToSplit >= m_moduleCols) {
+            OPENFHE_THROW("SplitColumns columns to split is >= current columns");
+        }
+        const uint32_t keptCols{m_moduleCols - columnsToSplit};
+
+        DCRTModuleType removed;
+        removed.m_params     = m_params;
+        removed.m_format     = m_format;
+        removed.m_moduleRows = m_moduleRows;
+        removed.m_moduleCols = columnsToSplit;
+        removed.m_vectors.reserve(m_moduleRows * columnsToSplit);
+        // compact the kept columns towards the front while moving the others out
         for (usint row = 0; row < m_moduleRows; row++) {
-            for (usint col = 0; col < m_moduleCols - columnsToDrop; col++) {
-                reduced.m_vectors[row * (m_moduleCols - columnsToDrop) + col] = m_vectors[row * m_moduleCols + col];
+            for (usint col = 0; col < m_moduleCols; col++) {
+                const size_t from{row * m_moduleCols + col};
+                const size_t to{row * keptCols + col};
+                if (col >= keptCols)
+                    removed.m_vectors.push_back(std::move(m_vectors[from]));
+                else if (to != from)
+                    m_vectors[to] = std::move(m_vectors[from]);
             }
         }
+        m_vectors.resize(m_moduleRows * keptCols);
+        m_moduleCols = keptCols;
+        return removed;
+    }
 
-        removed = DCRTModuleType(m_params, m_format, false, m_moduleRows, columnsToDrop);
-        for (usint row = 0; row < m_moduleRows; row++) {
-            for (usint col = 0; col < columnsToDrop; col++) {
-                removed.m_vectors[row * (m_moduleCols - columnsToDrop) + col] =
-                    m_vectors[row * m_moduleCols + m_moduleCols - columnsToDrop + col];
+    /**
+ * @brief Moves the columns of element behind the last column of this module.
+ * This is the inverse of SplitColumns; the polynomials are moved, not copied.
+ *
+ * @param element is a module with the same rows, params and format.
+ */
+    void AppendColumns(DCRTModuleType&& element) {
+        if (element.m_moduleRows != m_moduleRows) {
+            OPENFHE_THROW("AppendColumns requires modules with the same number of rows");
+        }
+        if (element.m_format != m_format) {
+            OPENFHE_THROW("AppendColumns requires modules in the same format");
+        }
+        const uint32_t cols{m_moduleCols + element.m_moduleCols};
+        if (m_moduleRows == 1) {
+            m_vectors.reserve(cols);
+            std::move(element.m_vectors.begin(), element.m_vectors.end(), std::back_inserter(m_vectors));
+        }
+        else {
+            std::vector<DCRTPolyType> vectors;
+            vectors.reserve(m_moduleRows * cols);
+            for (usint row = 0; row < m_moduleRows; row++) {
+                auto first = m_vectors.begin() + row * m_moduleCols;
+                std::move(first, first + m_moduleCols, std::back_inserter(vectors));
+                first = element.m_vectors.begin() + row * element.m_moduleCols;
+                std::move(first, first + element.m_moduleCols, std::back_inserter(vectors));
             }
+            m_vectors = std::move(vectors);
         }
-        return reduced;
+        m_moduleCols = cols;
+        element.m_vectors.clear();
+        element.m_moduleCols = 0;
     }
 
     /**
@@ -855,16 +1412,115 @@ public:
  */
     void SwitchFormat() {
         m_format = (m_format == Format::COEFFICIENT) ? Format::EVALUATION : Format::COEFFICIENT;
-        size_t size{m_vectors.size()};
-        // #pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-        for (size_t i = 0; i < size; ++i)
-            m_vectors[i].SwitchFormat();
+        if (m_vectors.empty())
+            return;
+        // All entries under one tower modulus are transformed as one batch that shares the
+        // twiddle tables. Each tower's batch is split into as many chunks as needed to keep
+        // every thread busy when there are fewer towers than threads.
+        const size_t entries{m_vectors.size()};
+        const size_t towers{GetNumOfElements()};
+        const size_t threads(GetThreadLimit(towers * entries));
+        const size_t chunks{std::min(entries, (threads + towers - 1) / towers)};
+        const size_t size{towers * chunks};
+#pragma omp parallel for num_threads(GetThreadLimit(size))
+        for (size_t j = 0; j < size; ++j) {
+            const size_t t{j / chunks};
+            const size_t begin{(j % chunks) * entries / chunks};
+            const size_t end{(j % chunks + 1) * entries / chunks};
+            std::vector<PolyType*> batch;
+            batch.reserve(end - begin);
+            for (size_t e = begin; e < end; ++e)
+                batch.push_back(&m_vectors[e].GetAllElements()[t]);
+            PolyType::SwitchFormat(batch);
+        }
+        for (auto& v : m_vectors)
+            v.OverrideFormat(m_format);
+    }
+
+    // The binary format stores the shape, format and params once, followed by the
+    // coefficients of all entries tower by tower: for each tower, the entries in row-major
+    // order, ringDim values each. No per-polynomial metadata is repeated.
+    template <class Archive>
+    typename std::enable_if<!cereal::traits::is_text_archive<Archive>::value, void>::type save(
+        Archive& ar, std::uint32_t const version) const {
+        CheckSerializedShape(m_vectors.size(), "save");
+        ar(::cereal::make_nvp("r", m_moduleRows));
+        ar(::cereal::make_nvp("c", m_moduleCols));
+        ar(::cereal::make_nvp("f", m_format));
+        ar(::cereal::make_nvp("p", m_params));
+        const size_t towers{m_params->GetParams().size()};
+        const size_t n{m_params->GetRingDimension()};
+        for (size_t t = 0; t < towers; ++t) {
+            for (const auto& v : m_vectors) {
+                // one dense block per tower, as NativeVector writes its own coefficients
+                const auto& values = v.GetElementAtIndex(t).GetValues();
+                ar(::cereal::binary_data(&values[0], n * sizeof(NativeInteger)));
+            }
+        }
+    }
+
+    template <class Archive>
+    typename std::enable_if<cereal::traits::is_text_archive<Archive>::value, void>::type save(
+        Archive& ar, std::uint32_t const version) const {
+        CheckSerializedShape(m_vectors.size(), "save");
+        ar(::cereal::make_nvp("r", m_moduleRows));
+        ar(::cereal::make_nvp("c", m_moduleCols));
+        ar(::cereal::make_nvp("f", m_format));
+        ar(::cereal::make_nvp("p", m_params));
+        ar(::cereal::make_nvp("v", m_vectors));
+    }
+
+    template <class Archive>
+    typename std::enable_if<!cereal::traits::is_text_archive<Archive>::value, void>::type load(
+        Archive& ar, std::uint32_t const version) {
+        if (version > SerializedVersion()) {
+            OPENFHE_THROW("serialized object version " + std::to_string(version) +
+                          " is from a later version of the library");
+        }
+        ar(::cereal::make_nvp("r", m_moduleRows));
+        ar(::cereal::make_nvp("c", m_moduleCols));
+        ar(::cereal::make_nvp("f", m_format));
+        ar(::cereal::make_nvp("p", m_params));
+        const size_t entries{size_t(m_moduleRows) * m_moduleCols};
+        m_vectors.clear();
+        CheckSerializedShape(entries, "load");
+        m_vectors.reserve(entries);
+        for (size_t i = 0; i < entries; i++)
+            m_vectors.emplace_back(m_params, m_format, false);
+        const auto& towerParams = m_params->GetParams();
+        const size_t n{m_params->GetRingDimension()};
+        for (size_t t = 0; t < towerParams.size(); ++t) {
+            for (auto& v : m_vectors) {
+                NativeVector values(n, towerParams[t]->GetModulus());
+                ar(::cereal::binary_data(&values[0], n * sizeof(NativeInteger)));
+                v.GetAllElements()[t].SetValues(std::move(values), m_format);
+            }
+        }
+    }
+
+    template <class Archive>
+    typename std::enable_if<cereal::traits::is_text_archive<Archive>::value, void>::type load(
+        Archive& ar, std::uint32_t const version) {
+        if (version > SerializedVersion()) {
+            OPENFHE_THROW("serialized object version " + std::to_string(version) +
+                          " is from a later version of the library");
+        }
+        ar(::cereal::make_nvp("r", m_moduleRows));
+        ar(::cereal::make_nvp("c", m_moduleCols));
+        ar(::cereal::make_nvp("f", m_format));
+        ar(::cereal::make_nvp("p", m_params));
+        ar(::cereal::make_nvp("v", m_vectors));
+        CheckSerializedShape(m_vectors.size(), "load");
     }
 
     std::string SerializedObjectName() const override {
         return "DCRTModule";
     }
 
+    static uint32_t SerializedVersion() {
+        return 1;
+    }
+
     inline const std::shared_ptr<Params>& GetParams() const {
         return m_params;
     }
@@ -873,6 +1529,10 @@ public:
         return m_vectors[row * m_moduleCols + col].GetElementAtIndex(i);
     }
 
+    PolyType& GetElementAtIndex(size_t row, size_t col, usint i) {
+        return m_vectors[row * m_moduleCols + col].GetAllElements()[i];
+    }
+
     void SetElementAtIndex(size_t row, size_t col, usint index, const PolyType& element) {
         m_vectors[row * m_moduleCols + col].SetElementAtIndex(index, element);
     }
@@ -882,12 +1542,56 @@ public:
                                         const std::vector<NativeInteger>& QHatInvModqPrecon,
                                         const std::vector<std::vector<NativeInteger>>& QHatModp,
                                         const std::vector<DoubleNativeInt>& modpBarrettMu) const {
-        DCRTModuleType tmp(paramsP, m_format, false, m_moduleRows, m_moduleCols);
-        size_t size{m_vectors.size()};
-        // #pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-        for (usint i = 0; i < size; i++) {
-            tmp.m_vectors[i] = m_vectors[i].ApproxSwitchCRTBasis(paramsQ, paramsP, QHatInvModq, QHatInvModqPrecon,
-                                                                 QHatModp, modpBarrettMu);
+        const size_t entries{m_vectors.size()};
+        const size_t sizeQ{std::min<size_t>(GetNumOfElements(), paramsQ->GetParams().size())};
+        const size_t sizeP{paramsP->GetParams().size()};
+        DCRTModuleType tmp(paramsP, m_format, true, m_moduleRows, m_moduleCols);
+
+        // x_i * QHat_i^(-1) mod q_i is shared by all target towers, so it is computed once per
+        // source tower; then every target tower of every entry accumulates its own sum
+        std::vector<std::vector<PolyType>> scaled(entries, std::vector<PolyType>(sizeQ));
+        size_t size{sizeQ * entries};
+#pragma omp parallel for num_threads(GetThreadLimit(size))
+        for (size_t k = 0; k < size; ++k) {
+            const size_t i{k / entries};
+            const auto& xi{m_vectors[k % entries].GetElementAtIndex(i)};
+#if defined(HAVE_INT128) && NATIVEINT == 64
+            PolyType y(xi);
+            const NativeInteger& qi{xi.GetModulus()};
+            const uint32_t ringDim{xi.GetRingDimension()};
+            for (uint32_t ri = 0; ri < ringDim; ++ri)
+                y[ri].ModMulFastConstEq(QHatInvModq[i], qi, QHatInvModqPrecon[i]);
+            scaled[k % entries][i] = std::move(y);
+#else
+            scaled[k % entries][i] = xi * QHatInvModq[i];
+#endif
+        }
+
+        size = sizeP * entries;
+#pragma omp parallel for num_threads(GetThreadLimit(size))
+        for (size_t k = 0; k < size; ++k) {
+            const size_t j{k / entries};
+            const auto& xs{scaled[k % entries]};
+            auto& out{tmp.m_vectors[k % entries].GetAllElements()[j]};
+#if defined(HAVE_INT128) && NATIVEINT == 64
+            const NativeInteger& pj{out.GetModulus()};
+            const uint32_t ringDim{out.GetRingDimension()};
+            NativeVector values(ringDim, pj);
+            for (uint32_t ri = 0; ri < ringDim; ++ri) {
+                DoubleNativeInt sum{0};
+                for (size_t i = 0; i < sizeQ; ++i)
+                    sum += Mul128(xs[i][ri].template ConvertToInt<uint64_t>(),
+                                  QHatModp[i][j].template ConvertToInt<uint64_t>());
+                values[ri] = BarrettUint128ModUint64(sum, pj.template ConvertToInt<uint64_t>(), modpBarrettMu[j]);
+            }
+            out.SetValues(std::move(values), m_format);
+#else
+            for (size_t i = 0; i < sizeQ; ++i) {
+                auto temp{xs[i]};
+                temp.SwitchModulus(out.GetModulus(), out.GetRootOfUnity(), 0, 0);
+                out += (temp *= QHatModp[i][j]);
+            }
+#endif
         }
         return tmp;
     }
@@ -1078,6 +1782,248 @@ protected:
     }
 
 protected:
+    /**
+   * @brief Checks that a module being serialized is consistent: rows x cols entries, all with
+   * the towers and ring dimension of the module params.
+   */
+    void CheckSerializedShape(size_t entries, const std::string& op) const {
+        if (m_params == nullptr || m_params->GetParams().empty())
+            OPENFHE_THROW("DCRTModule " + op + ": missing element parameters");
+        if (m_moduleRows == 0 || m_moduleCols == 0 || entries != size_t(m_moduleRows) * m_moduleCols)
+            OPENFHE_THROW("DCRTModule " + op + ": " + std::to_string(entries) + " entries do not match a " +
+                          std::to_string(m_moduleRows) + "x" + std::to_string(m_moduleCols) + " module");
+        const size_t towers{m_params->GetParams().size()};
+        for (const auto& v : m_vectors) {
+            if (v.GetNumOfElements() != towers || v.GetRingDimension() != m_params->GetRingDimension())
+                OPENFHE_THROW("DCRTModule " + op + ": entries must have the " + std::to_string(towers) +
+                              " towers of the module parameters");
+        }
+    }
+
+    /**
+   * @brief Shared kernel of the outer products: computes outputs[k] = lhs_i * rhs_i for an item
+   * k = (i, i) and lhs_i * rhs_j + lhs_j * rhs_i (symmetrize) or lhs_i * rhs_j for an item (i, j),
+   * in one parallel pass over the towers and items. With square set, lhs and rhs are the same and
+   * the cross product is computed once and doubled. The outputs get the towers of the inputs.
+   */
+    static void PairProducts(const std::vector<const DCRTPolyType*>& lhs, const std::vector<const DCRTPolyType*>& rhs,
+                             const std::vector<std::pair<usint, usint>>& items,
+                             const std::vector<DCRTPolyType*>& outputs, usint numTowers, bool symmetrize,
+                             bool square) {
+        const size_t numItems{items.size()};
+        const size_t size{numTowers * numItems};
+#pragma omp parallel for num_threads(GetThreadLimit(size))
+        for (size_t k = 0; k < size; ++k) {
+            const size_t t{k / numItems};
+            const size_t item{k % numItems};
+            const usint i{items[item].first};
+            const usint j{items[item].second};
+            const bool cross{i != j};
+            const auto& ai{lhs[i]->GetElementAtIndex(t)};
+            const auto& bj{rhs[j]->GetElementAtIndex(t)};
+            auto& out{outputs[item]->GetAllElements()[t]};
+#if defined(HAVE_INT128) && NATIVEINT == 64
+            const NativeInteger& modulus{ai.GetModulus()};
+            LazyBarrettSum sum(modulus);
+            const uint32_t ringDim{ai.GetRingDimension()};
+            const NativeVector& av{ai.GetValues()};
+            const NativeVector& bv{bj.GetValues()};
+            const NativeVector& aj{lhs[j]->GetElementAtIndex(t).GetValues()};
+            const NativeVector& bi{rhs[i]->GetElementAtIndex(t).GetValues()};
+            const bool twoTerms{cross && symmetrize && !square};
+            const bool doubled{cross && symmetrize && square};
+            NativeVector values(ringDim, modulus);
+            for (uint32_t ri = 0; ri < ringDim; ++ri) {
+                sum.Reset();
+                sum.AddProduct(av[ri].template ConvertToInt<uint64_t>(), bv[ri].template ConvertToInt<uint64_t>());
+                if (twoTerms)
+                    sum.AddProduct(aj[ri].template ConvertToInt<uint64_t>(),
+                                   bi[ri].template ConvertToInt<uint64_t>());
+                values[ri] = sum.Get();
+                if (doubled)
+                    values[ri].ModAddFastEq(values[ri], modulus);
+            }
+            out.SetValues(std::move(values), ai.GetFormat());
+#else
+            out = ai.TimesNoCheck(bj);
+            if (cross && symmetrize) {
+                if (square)
+                    out += PolyType(out);
+                else
+                    out += lhs[j]->GetElementAtIndex(t).TimesNoCheck(rhs[i]->GetElementAtIndex(t));
+            }
+#endif
+        }
+    }
+
+    void MultiplyAccumulateInPlace(const DCRTModuleType& a, const DCRTModuleType& b, bool subtract) {
+        if (a.m_moduleRows == 1 && a.m_moduleCols == 1) {
+            if (b.m_moduleRows != m_moduleRows || b.m_moduleCols != m_moduleCols)
+                OPENFHE_THROW("MultiplyAccumulateInPlace size mismatch");
+            AccumulateProducts(a, b, 1, subtract, [](size_t e, usint) { return std::make_pair(size_t(0), e); });
+        }
+        else if (b.m_moduleRows == 1 && b.m_moduleCols == 1) {
+            if (a.m_moduleRows != m_moduleRows || a.m_moduleCols != m_moduleCols)
+                OPENFHE_THROW("MultiplyAccumulateInPlace size mismatch");
+            AccumulateProducts(a, b, 1, subtract, [](size_t e, usint) { return std::make_pair(e, size_t(0)); });
+        }
+        else {
+            if (a.m_moduleCols != b.m_moduleRows || a.m_moduleRows != m_moduleRows || b.m_moduleCols != m_moduleCols)
+                OPENFHE_THROW("MultiplyAccumulateInPlace size mismatch");
+            const usint inner{a.m_moduleCols};
+            const usint cols{m_moduleCols};
+            AccumulateProducts(a, b, inner, subtract, [inner, cols](size_t e, usint i) {
+                return std::make_pair((e / cols) * inner + i, i * cols + e % cols);
+            });
+        }
+    }
+
+    /**
+   * @brief Shared kernel of the fused in-place products: for every output entry e,
+   * this[e] +/-= sum_i a[index(e, i).first] * b[index(e, i).second] over `terms` terms.
+   * With 128-bit integers the sum is accumulated lazily and reduced once per coefficient.
+   */
+    template <typename IndexFunc>
+    void AccumulateProducts(const DCRTModuleType& a, const DCRTModuleType& b, usint terms, bool subtract,
+                            IndexFunc index) {
+        if (m_format != Format::EVALUATION || a.m_format != Format::EVALUATION || b.m_format != Format::EVALUATION) {
+            OPENFHE_THROW("In-place products supported only in Format::EVALUATION");
+        }
+        const size_t entries{m_vectors.size()};
+        const size_t towers{GetNumOfElements()};
+        if (a.GetNumOfElements() < towers || b.GetNumOfElements() < towers) {
+            OPENFHE_THROW("In-place products require operands with at least as many towers as the result");
+        }
+        for (const auto& v : m_vectors) {
+            if (v.GetElementAtIndex(0).IsEmpty())
+                OPENFHE_THROW("In-place products require an initialized result");
+        }
+        const size_t size{towers * entries};
+#pragma omp parallel for num_threads(GetThreadLimit(size))
+        for (size_t j = 0; j < size; ++j) {
+            const size_t t{j / entries};
+            const size_t e{j % entries};
+            auto& out = m_vectors[e].GetAllElements()[t];
+#if defined(HAVE_INT128) && NATIVEINT == 64
+            const NativeInteger& modulus{out.GetModulus()};
+            LazyBarrettSum sum(modulus);
+            const uint32_t ringDim{out.GetRingDimension()};
+            for (uint32_t ri = 0; ri < ringDim; ++ri) {
+                sum.Reset(subtract ? 0 : out[ri].template ConvertToInt<uint64_t>());
+                for (usint i = 0; i < terms; i++) {
+                    const auto ab{index(e, i)};
+                    sum.AddProduct(
+                        a.m_vectors[ab.first].GetElementAtIndex(t)[ri].template ConvertToInt<uint64_t>(),
+                        b.m_vectors[ab.second].GetElementAtIndex(t)[ri].template ConvertToInt<uint64_t>());
+                }
+                const NativeInteger r{sum.Get()};
+                out[ri] = subtract ? out[ri].ModSubFast(r, modulus) : r;
+            }
+#else
+            for (usint i = 0; i < terms; i++) {
+                const auto ab{index(e, i)};
+                auto prod{a.m_vectors[ab.first].GetElementAtIndex(t).TimesNoCheck(
+                    b.m_vectors[ab.second].GetElementAtIndex(t))};
+                if (subtract)
+                    out -= prod;
+                else
+                    out += prod;
+            }
+#endif
+        }
+    }
+
+    /**
+   * @brief Shared kernel of the constant operations: applies op(x, c, cPrecon, q) to every
+   * coefficient x of every entry, with c the residue of the constant for the tower of x.
+   */
+    template <typename OpFunc>
+    void ConstantInPlace(const std::vector<Integer>& crtConstant, OpFunc op) {
+        const size_t entries{m_vectors.size()};
+        const size_t towers{GetNumOfElements()};
+        if (crtConstant.size() < towers) {
+            OPENFHE_THROW("Constant operations require a residue for every tower");
+        }
+        const size_t size{towers * entries};
+#pragma omp parallel for num_threads(GetThreadLimit(size))
+        for (size_t j = 0; j < size; ++j) {
+            const size_t t{j / entries};
+            auto& poly = m_vectors[j % entries].GetAllElements()[t];
+            const NativeInteger& q{poly.GetModulus()};
+            const NativeInteger c{NativeInteger(crtConstant[t]).Mod(q)};
+            const NativeInteger cPrecon{c.PrepModMulConst(q)};
+            const uint32_t ringDim{poly.GetRingDimension()};
+            for (uint32_t ri = 0; ri < ringDim; ++ri)
+                op(poly[ri], c, cPrecon, q);
+        }
+    }
+
+    /**
+   * @brief Shared kernel of the broadcast polynomial operations: applies op(x, y, q, mu) to
+   * every coefficient x of every entry, with y the matching coefficient of poly.
+   */
+    template <typename OpFunc>
+    void BroadcastPolyInPlace(const DCRTPolyType& poly, OpFunc op) {
+        if (m_format != poly.GetFormat()) {
+            OPENFHE_THROW("Broadcast polynomial operations require operands in the same format");
+        }
+        const size_t entries{m_vectors.size()};
+        const size_t towers{GetNumOfElements()};
+        if (poly.GetNumOfElements() < towers) {
+            OPENFHE_THROW("Broadcast polynomial operations require at least as many towers as the module");
+        }
+        // the towers of poly must be those of the module, and the Barrett constants are shared by all entries
+        const auto& moduli{m_params->GetParams()};
+        const auto& polyModuli{poly.GetParams()->GetParams()};
+        std::vector<NativeInteger> mu(towers);
+        for (size_t t = 0; t < towers; ++t) {
+            if (polyModuli[t]->GetModulus() != moduli[t]->GetModulus()) {
+                OPENFHE_THROW("Broadcast polynomial operations require the towers of the module");
+            }
+            mu[t] = moduli[t]->GetModulus().ComputeMu();
+        }
+        const size_t size{towers * entries};
+#pragma omp parallel for num_threads(GetThreadLimit(size))
+        for (size_t j = 0; j < size; ++j) {
+            const size_t t{j / entries};
+            auto& out = m_vectors[j % entries].GetAllElements()[t];
+            const NativeVector& pv{poly.GetElementAtIndex(t).GetValues()};
+            const NativeInteger& q{out.GetModulus()};
+            const uint32_t ringDim{out.GetRingDimension()};
+            for (uint32_t ri = 0; ri < ringDim; ++ri)
+                op(out[ri], pv[ri], q, mu[t]);
+        }
+    }
+
+    /**
+   * @brief Applies an entry-wise decomposition and regroups the result by digit: digit d of the
+   * result holds digit d of every entry. All entries share the params, so they have the same
+   * number of digits.
+   */
+    template <typename DecomposeFunc>
+    std::vector<DCRTModuleType> DecomposeEntries(DecomposeFunc decompose) const {
+        const size_t entries{m_vectors.size()};
+        std::vector<std::vector<DCRTPolyType>> decomposed(entries);
+        for (size_t e = 0; e < entries; ++e)
+            decomposed[e] = decompose(m_vectors[e]);
+
+        const size_t digits{entries == 0 ? 0 : decomposed[0].size()};
+        std::vector<DCRTModuleType> result;
+        result.reserve(digits);
+        for (size_t d = 0; d < digits; ++d) {
+            DCRTModuleType digit;
+            digit.m_params     = m_params;
+            digit.m_format     = decomposed[0][d].GetFormat();
+            digit.m_moduleRows = m_moduleRows;
+            digit.m_moduleCols = m_moduleCols;
+            digit.m_vectors.reserve(entries);
+            for (size_t e = 0; e < entries; ++e)
+                digit.m_vectors.push_back(std::move(decomposed[e][d]));
+            result.push_back(std::move(digit));
+        }
+        return result;
+    }
+
     std::shared_ptr<Params> m_params{std::make_shared<Params>()};
     Format m_format{Format::EVALUATION};
     std::vector<DCRTPolyType> m_vectors;
@@ -710,13 +710,36 @@ void DCRTPolyImpl<VecType>::DropLastElements(size_t i) {
     m_params.reset(newP);
 }
 
+template <typename VecType>
+void DCRTPolyImpl<VecType>::DropLastElements(size_t i, const std::shared_ptr<Params>& paramsQl) {
+    if (m_vectors.size() <= i)
+        OPENFHE_THROW(std::string(__func__) + ": Too few towers in input.");
+    if (paramsQl->GetParams().size() != m_vectors.size() - i)
+        OPENFHE_THROW(std::string(__func__) + ": Params do not match the remaining towers.");
+    m_vectors.resize(m_vectors.size() - i);
+    m_params = paramsQl;
+}
+
 // used for CKKS rescaling
 template <typename VecType>
 void DCRTPolyImpl<VecType>::DropLastElementAndScale(const std::vector<NativeInteger>& QlQlInvModqlDivqlModq,
                                                     const std::vector<NativeInteger>& qlInvModq) {
+    if (m_vectors.size() <= 1)
+        OPENFHE_THROW(std::string(__func__) + ": Removing last element of DCRTPoly renders it invalid.");
+    auto newP = std::make_shared<Params>(*m_params);
+    newP->PopLastParam();
+    this->DropLastElementAndScale(QlQlInvModqlDivqlModq, qlInvModq, newP);
+}
+
+template <typename VecType>
+void DCRTPolyImpl<VecType>::DropLastElementAndScale(const std::vector<NativeInteger>& QlQlInvModqlDivqlModq,
+                                                    const std::vector<NativeInteger>& qlInvModq,
+                                                    const std::shared_ptr<Params>& paramsQl) {
+    if (m_vectors.size() <= 1)
+        OPENFHE_THROW(std::string(__func__) + ": Removing last element of DCRTPoly renders it invalid.");
     auto lastPoly(m_vectors.back());
     lastPoly.SetFormat(Format::COEFFICIENT);
-    this->DropLastElement();
+    this->DropLastElements(1, paramsQl);
     size_t size{m_vectors.size()};
 
 #pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
@@ -209,6 +209,18 @@ public:
     void DropLastElementAndScale(const std::vector<NativeInteger>& QlQlInvModqlDivqlModq,
                                  const std::vector<NativeInteger>& qlInvModq) override;
 
+    /**
+   * @brief Drops the last i towers and shares paramsQl, which must describe the
+   * remaining towers, instead of allocating a new parameter set.
+   */
+    void DropLastElements(size_t i, const std::shared_ptr<Params>& paramsQl);
+
+    /**
+   * @brief Same as DropLastElementAndScale, sharing paramsQl for the remaining towers.
+   */
+    void DropLastElementAndScale(const std::vector<NativeInteger>& QlQlInvModqlDivqlModq,
+                                 const std::vector<NativeInteger>& qlInvModq, const std::shared_ptr<Params>& paramsQl);
+
     void ModReduce(const NativeInteger& t, const std::vector<NativeInteger>& tModqPrecon,
                    const NativeInteger& negtInvModq, const NativeInteger& negtInvModqPrecon,
                    const std::vector<NativeInteger>& qlInvModq,
@@ -429,6 +429,47 @@ void PolyImpl<VecType>::SwitchFormat() {
     ChineseRemainderTransformFTT<VecType>().ForwardTransformToBitReverseInPlace(ru, co, &(*m_values));
 }
 
+template <typename VecType>
+void PolyImpl<VecType>::SwitchFormat(const std::vector<PolyImpl*>& polys) {
+    for (auto* p : polys)
+        p->SwitchFormat();
+}
+
+template <>
+void PolyImpl<NativeVector>::SwitchFormat(const std::vector<PolyImpl*>& polys) {
+    if (polys.empty())
+        return;
+
+    const auto& params{polys[0]->m_params};
+    const auto& co{params->GetCyclotomicOrder()};
+    const auto& ru{params->GetRootOfUnity()};
+    const Format format{polys[0]->m_format};
+
+    if (params->GetRingDimension() != (co >> 1)) {
+        for (auto* p : polys)
+            p->SwitchFormat();
+        return;
+    }
+
+    std::vector<NativeVector*> values;
+    values.reserve(polys.size());
+    for (auto* p : polys) {
+        if (!p->m_values)
+            OPENFHE_THROW("Poly switch format to empty values");
+        if (p->m_format != format || p->m_params->GetModulus() != params->GetModulus())
+            OPENFHE_THROW("Batched switch format requires the same modulus and format");
+        values.push_back(p->m_values.get());
+    }
+
+    const Format newFormat{format == Format::COEFFICIENT ? Format::EVALUATION : Format::COEFFICIENT};
+    if (newFormat == Format::COEFFICIENT)
+        ChineseRemainderTransformFTT<NativeVector>().InverseTransformFromBitReverseInPlace(ru, co, values);
+    else
+        ChineseRemainderTransformFTT<NativeVector>().ForwardTransformToBitReverseInPlace(ru, co, values);
+    for (auto* p : polys)
+        p->m_format = newFormat;
+}
+
 template <typename VecType>
 void PolyImpl<VecType>::ArbitrarySwitchFormat() {
     if (m_values == nullptr)
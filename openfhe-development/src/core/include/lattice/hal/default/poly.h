@@ -318,6 +318,15 @@ public:
     void SwitchModulus(const Integer& modulus, const Integer& rootOfUnity, const Integer& modulusArb,
                        const Integer& rootOfUnityArb) override;
     void SwitchFormat() override;
+
+    /**
+   * @brief Switches the format of several polynomials at once. For native power-of-two
+   * rings, polynomials with the same modulus and format are transformed as one batch
+   * that looks up the twiddle tables once and interleaves the butterflies.
+   *
+   * @param &polys are the polynomials to switch; all must have the same modulus and format.
+   */
+    static void SwitchFormat(const std::vector<PolyImpl*>& polys);
     void MakeSparse(uint32_t wFactor) override;
     bool InverseExists() const override;
     double Norm() const override;
@@ -361,6 +370,10 @@ protected:
     void ArbitrarySwitchFormat();
 };
 
+// batched transforms are only available for native polynomials
+template <>
+void PolyImpl<NativeVector>::SwitchFormat(const std::vector<PolyImpl<NativeVector>*>& polys);
+
 }  // namespace lbcrypto
 
 #endif
@@ -131,6 +131,27 @@ std::shared_ptr<int64_t> DiscreteGaussianGeneratorImpl<VecType>::GenerateIntVect
     return ans;
 }
 
+template <typename VecType>
+std::shared_ptr<int64_t> DiscreteGaussianGeneratorImpl<VecType>::GenerateIntVector(uint32_t size, PRNG& prng) const {
+    std::shared_ptr<int64_t> ans(new int64_t[size], std::default_delete<int64_t[]>());
+
+    if (!peikert) {
+        for (uint32_t i = 0; i < size; ++i)
+            (ans.get())[i] = GenerateIntegerKarney(0, m_std, prng);
+        return ans;
+    }
+
+    for (uint32_t i = 0; i < size; ++i) {
+        double seed = UniformReal(prng) - 0.5;
+        double tmp  = std::abs(seed) - m_a / 2;
+        int64_t val = 0;
+        if (tmp > 0)
+            val = static_cast<int64_t>(FindInVector(m_vals, tmp)) * (seed > 0 ? 1 : -1);
+        (ans.get())[i] = val;
+    }
+    return ans;
+}
+
 template <typename VecType>
 uint32_t DiscreteGaussianGeneratorImpl<VecType>::FindInVector(const std::vector<double>& S, double search) const {
     // STL binary search implementation
@@ -222,10 +243,12 @@ int32_t DiscreteGaussianGeneratorImpl<VecType>::GenerateInteger(double mean, dou
 
 template <typename VecType>
 int64_t DiscreteGaussianGeneratorImpl<VecType>::GenerateIntegerKarney(double mean, double stddev) {
-    std::uniform_int_distribution<int64_t> uniform_sign(0, 1);
-    std::uniform_int_distribution<int64_t> uniform_j(0, std::ceil(stddev) - 1);
+    return GenerateIntegerKarney(mean, stddev, PseudoRandomNumberGenerator::GetPRNG());
+}
 
-    PRNG& g = PseudoRandomNumberGenerator::GetPRNG();
+template <typename VecType>
+int64_t DiscreteGaussianGeneratorImpl<VecType>::GenerateIntegerKarney(double mean, double stddev, PRNG& g) {
+    const uint64_t rangeJ = static_cast<uint64_t>(std::ceil(stddev));
 
     while (true) {
         // STEP D1
@@ -236,15 +259,13 @@ int64_t DiscreteGaussianGeneratorImpl<VecType>::GenerateIntegerKarney(double mea
             continue;
 
         // STEP D3
-        int64_t s = uniform_sign(g);
-        if (s == 0)
-            s = -1;
+        int64_t s = (g() & 1) ? 1 : -1;
 
         // STEP D4
         double di0 = stddev * k + s * mean;
         int64_t i0 = std::ceil(di0);
         double x0  = (i0 - di0) / stddev;
-        int64_t j  = uniform_j(g);
+        int64_t j  = static_cast<int64_t>(UniformInt(g, rangeJ));
 
         double x = x0 + j / stddev;
 
@@ -264,6 +285,37 @@ int64_t DiscreteGaussianGeneratorImpl<VecType>::GenerateIntegerKarney(double mea
     }
 }
 
+template <typename VecType>
+double DiscreteGaussianGeneratorImpl<VecType>::UniformReal(PRNG& g) {
+    // two separate statements fix the order of the draws
+    const uint64_t hi = g() >> 5;
+    const uint64_t lo = g() >> 6;
+    return std::ldexp(static_cast<double>((hi << 26) | lo), -53);
+}
+
+template <typename VecType>
+float DiscreteGaussianGeneratorImpl<VecType>::UniformRealFloat(PRNG& g) {
+    return std::ldexp(static_cast<float>(g() >> 8), -24);
+}
+
+template <typename VecType>
+uint64_t DiscreteGaussianGeneratorImpl<VecType>::UniformInt(PRNG& g, uint64_t bound) {
+    if (bound <= 1)
+        return 0;
+    // the draws are masked to the smallest power of two not below bound and rejected until one
+    // falls below bound
+    uint64_t mask = bound - 1;
+    for (uint32_t shift = 1; shift < 64; shift <<= 1)
+        mask |= mask >> shift;
+    while (true) {
+        const uint64_t hi = g();
+        const uint64_t lo = g();
+        const uint64_t r  = ((hi << 32) | lo) & mask;
+        if (r < bound)
+            return r;
+    }
+}
+
 template <typename VecType>
 bool DiscreteGaussianGeneratorImpl<VecType>::AlgorithmP(PRNG& g, int n) {
     while (n-- && AlgorithmH(g)) {
@@ -283,20 +335,19 @@ int32_t DiscreteGaussianGeneratorImpl<VecType>::AlgorithmG(PRNG& g) {
 // enough precision is encountered, call the double-precision algorithm
 template <typename VecType>
 bool DiscreteGaussianGeneratorImpl<VecType>::AlgorithmH(PRNG& g) {
-    std::uniform_real_distribution<float> dist(0, 1);
     float h_a, h_b;
-    h_a = dist(g);
+    h_a = UniformRealFloat(g);
 
     // less than the half
     if (h_a > 0.5)
         return true;
     if (h_a < 0.5) {
         for (;;) {
-            h_b = dist(g);
+            h_b = UniformRealFloat(g);
             if (h_b > h_a)
                 return false;
             else if (h_b < h_a)
-                h_a = dist(g);
+                h_a = UniformRealFloat(g);
             else  // numbers are equal - need higher precision
                 return AlgorithmHDouble(g);
             if (h_a > h_b)
@@ -312,18 +363,17 @@ bool DiscreteGaussianGeneratorImpl<VecType>::AlgorithmH(PRNG& g) {
 
 template <typename VecType>
 bool DiscreteGaussianGeneratorImpl<VecType>::AlgorithmHDouble(PRNG& g) {
-    std::uniform_real_distribution<double> dist(0, 1);
     double h_a, h_b;
-    h_a = dist(g);
+    h_a = UniformReal(g);
     // less than the half
     if (!(h_a < 0.5))
         return true;
     for (;;) {
-        h_b = dist(g);
+        h_b = UniformReal(g);
         if (!(h_b < h_a))
             return false;
         else
-            h_a = dist(g);
+            h_a = UniformReal(g);
         if (!(h_a < h_b))
             return true;
     }
@@ -331,20 +381,18 @@ bool DiscreteGaussianGeneratorImpl<VecType>::AlgorithmHDouble(PRNG& g) {
 
 template <typename VecType>
 bool DiscreteGaussianGeneratorImpl<VecType>::AlgorithmB(PRNG& g, int32_t k, double x) {
-    std::uniform_real_distribution<float> dist(0.0, 1.0);
-
     float y   = x;
     int32_t n = 0, m = 2 * k + 2;
     float z, r;
     float rTemp;
 
     for (;; ++n) {
-        z = dist(g);
+        z = UniformRealFloat(g);
         if (z > y) {
             break;
         }
         else if (z < y) {
-            r     = dist(g);
+            r     = UniformRealFloat(g);
             rTemp = (2 * k + x) / m;
             if (r > rTemp)
                 break;
@@ -363,17 +411,15 @@ bool DiscreteGaussianGeneratorImpl<VecType>::AlgorithmB(PRNG& g, int32_t k, doub
 
 template <typename VecType>
 bool DiscreteGaussianGeneratorImpl<VecType>::AlgorithmBDouble(PRNG& g, int32_t k, double x) {
-    std::uniform_real_distribution<double> dist(0.0, 1.0);
-
     double y  = x;
     int32_t n = 0, m = 2 * k + 2;
     double z, r;
 
     for (;; ++n) {
-        z = dist(g);
+        z = UniformReal(g);
         if (!(z < y))
             break;
-        r = dist(g);
+        r = UniformReal(g);
         if (!(r < (2 * k + x) / m))
             break;
         y = z;
@@ -135,6 +135,19 @@ public:
    */
     std::shared_ptr<int64_t> GenerateIntVector(uint32_t size) const;
 
+    /**
+   * @brief      Returns a generated integer vector drawn from the given engine instead of the
+   * library PRNG, e.g. a BLAKE2 engine with its own counter, so that independent streams can be
+   * sampled in parallel. The 32-bit outputs of the engine are turned into reals explicitly, so the
+   * values depend only on the engine and not on the standard library. Uses Peikert's inversion
+   * method, or Karney's method for large standard deviations.
+   * @param size The number of values to return.
+   * @param prng The engine to draw from.
+   * @return     A pointer to an array of integer values generated with the
+   * distribution.
+   */
+    std::shared_ptr<int64_t> GenerateIntVector(uint32_t size, PRNG& prng) const;
+
     /**
    * @brief  Returns a generated integer. Uses Peikert's inversion method.
    * @return A random value within this Discrete Gaussian Distribution.
@@ -190,6 +203,15 @@ public:
    */
     static int64_t GenerateIntegerKarney(double mean, double stddev);
 
+    /**
+   * @brief Same as GenerateIntegerKarney(mean, stddev), drawing from the given engine.
+   * @param mean center of discrecte Gaussian distribution.
+   * @param stddev standard deviation of discrete Gaussian distribution.
+   * @param g the engine to draw from.
+   * @return A random value within this Discrete Gaussian Distribution.
+   */
+    static int64_t GenerateIntegerKarney(double mean, double stddev, PRNG& g);
+
 private:
     // Gyana to add precomputation methods and data members
     // all parameters are set as int because it is assumed that they are used for
@@ -209,6 +231,19 @@ private:
         return pow(M_E, sigmaFactor * (x - mean) * (x - mean));
     }
 
+    /**
+   * @brief Uniform real in [0, 1) from 53 bits of two 32-bit draws.
+   */
+    static double UniformReal(PRNG& g);
+    /**
+   * @brief Uniform real in [0, 1) in single precision from 24 bits of one 32-bit draw.
+   */
+    static float UniformRealFloat(PRNG& g);
+    /**
+   * @brief Uniform integer in [0, bound) by rejection from 64-bit draws.
+   */
+    static uint64_t UniformInt(PRNG& g, uint64_t bound);
+
     /**
    * @brief Subroutine used by Karney's Method to accept an integer with
    * probability exp(-n/2).
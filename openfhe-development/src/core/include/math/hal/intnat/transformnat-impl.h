@@ -302,6 +302,21 @@ template <typename VecType>
 void NumberTheoreticTransformNat<VecType>::ForwardTransformToBitReverseInPlace(const VecType& rootOfUnityTable,
                                                                                const VecType& preconRootOfUnityTable,
                                                                                VecType* element) {
+    ForwardTransformToBitReverseInPlaceKernel(rootOfUnityTable, preconRootOfUnityTable, SingleElement{element});
+}
+
+template <typename VecType>
+void NumberTheoreticTransformNat<VecType>::ForwardTransformToBitReverseInPlace(const VecType& rootOfUnityTable,
+                                                                               const VecType& preconRootOfUnityTable,
+                                                                               const std::vector<VecType*>& elements) {
+    if (!elements.empty())
+        ForwardTransformToBitReverseInPlaceKernel(rootOfUnityTable, preconRootOfUnityTable, elements);
+}
+
+template <typename VecType>
+template <typename Batch>
+void NumberTheoreticTransformNat<VecType>::ForwardTransformToBitReverseInPlaceKernel(
+    const VecType& rootOfUnityTable, const VecType& preconRootOfUnityTable, const Batch& elements) {
     //
     // NTT based on the Cooley-Tukey (CT) butterfly
     // Inputs: element (vector of size n in standard ordering)
@@ -317,43 +332,16 @@ void NumberTheoreticTransformNat<VecType>::ForwardTransformToBitReverseInPlace(c
     //             element[j1 + 0] = (loVal + hiVal) mod modulus
     //             element[j1 + t] = (loVal - hiVal) mod modulus
     //
+    // Every element of the batch is transformed inside the twiddle loop, so each twiddle
+    // factor is loaded once per batch.
+    //
 
-    const auto modulus{element->GetModulus()};
-    const uint32_t n(element->GetLength() >> 1);
-    for (uint32_t m{1}, t{n}, logt{GetMSB(t)}; m < n; m <<= 1, t >>= 1, --logt) {
-        for (uint32_t i{0}; i < m; ++i) {
-            auto omega{rootOfUnityTable[i + m]};
-            auto preconOmega{preconRootOfUnityTable[i + m]};
-            for (uint32_t j1{i << logt}, j2{j1 + t}; j1 < j2; ++j1) {
-                auto omegaFactor{(*element)[j1 + t]};
-                omegaFactor.ModMulFastConstEq(omega, modulus, preconOmega);
-                auto loVal{(*element)[j1 + 0]};
-#if defined(__GNUC__) && !defined(__clang__)
-                auto hiVal{loVal + omegaFactor};
-                if (hiVal >= modulus)
-                    hiVal -= modulus;
-                if (loVal < omegaFactor)
-                    loVal += modulus;
-                loVal -= omegaFactor;
-                (*element)[j1 + 0] = hiVal;
-                (*element)[j1 + t] = loVal;
-#else
-                // fixes Clang slowdown issue, but requires lowVal be less than modulus
-                (*element)[j1 + 0] += omegaFactor - (omegaFactor >= (modulus - loVal) ? modulus : 0);
-                if (omegaFactor > loVal)
-                    loVal += modulus;
-                (*element)[j1 + t] = loVal - omegaFactor;
-#endif
-            }
-        }
-    }
-    // peeled off last ntt stage for performance
-    for (uint32_t i{0}; i < (n << 1); i += 2) {
-        auto omegaFactor{(*element)[i + 1]};
-        auto omega{rootOfUnityTable[(i >> 1) + n]};
-        auto preconOmega{preconRootOfUnityTable[(i >> 1) + n]};
+    const auto modulus{elements[0]->GetModulus()};
+    const uint32_t n(elements[0]->GetLength() >> 1);
+    auto butterfly = [&modulus](IntType& lo, IntType& hi, const IntType& omega, const IntType& preconOmega) {
+        auto omegaFactor{hi};
         omegaFactor.ModMulFastConstEq(omega, modulus, preconOmega);
-        auto loVal{(*element)[i + 0]};
+        auto loVal{lo};
 #if defined(__GNUC__) && !defined(__clang__)
         auto hiVal{loVal + omegaFactor};
         if (hiVal >= modulus)
@@ -361,14 +349,34 @@ void NumberTheoreticTransformNat<VecType>::ForwardTransformToBitReverseInPlace(c
         if (loVal < omegaFactor)
             loVal += modulus;
         loVal -= omegaFactor;
-        (*element)[i + 0] = hiVal;
-        (*element)[i + 1] = loVal;
+        lo = hiVal;
+        hi = loVal;
 #else
-        (*element)[i + 0] += omegaFactor - (omegaFactor >= (modulus - loVal) ? modulus : 0);
+        // fixes Clang slowdown issue, but requires lowVal be less than modulus
+        lo += omegaFactor - (omegaFactor >= (modulus - loVal) ? modulus : 0);
         if (omegaFactor > loVal)
             loVal += modulus;
-        (*element)[i + 1] = loVal - omegaFactor;
+        hi = loVal - omegaFactor;
 #endif
+    };
+
+    for (uint32_t m{1}, t{n}, logt{GetMSB(t)}; m < n; m <<= 1, t >>= 1, --logt) {
+        for (uint32_t i{0}; i < m; ++i) {
+            auto omega{rootOfUnityTable[i + m]};
+            auto preconOmega{preconRootOfUnityTable[i + m]};
+            for (size_t k{0}; k < elements.size(); ++k) {
+                auto& element{*elements[k]};
+                for (uint32_t j1{i << logt}, j2{j1 + t}; j1 < j2; ++j1)
+                    butterfly(element[j1 + 0], element[j1 + t], omega, preconOmega);
+            }
+        }
+    }
+    // peeled off last ntt stage for performance
+    for (uint32_t i{0}; i < (n << 1); i += 2) {
+        auto omega{rootOfUnityTable[(i >> 1) + n]};
+        auto preconOmega{preconRootOfUnityTable[(i >> 1) + n]};
+        for (size_t k{0}; k < elements.size(); ++k)
+            butterfly((*elements[k])[i + 0], (*elements[k])[i + 1], omega, preconOmega);
     }
 }
 
@@ -511,6 +519,24 @@ template <typename VecType>
 void NumberTheoreticTransformNat<VecType>::InverseTransformFromBitReverseInPlace(
     const VecType& rootOfUnityInverseTable, const VecType& preconRootOfUnityInverseTable, const IntType& cycloOrderInv,
     const IntType& preconCycloOrderInv, VecType* element) {
+    InverseTransformFromBitReverseInPlaceKernel(rootOfUnityInverseTable, preconRootOfUnityInverseTable, cycloOrderInv,
+                                                preconCycloOrderInv, SingleElement{element});
+}
+
+template <typename VecType>
+void NumberTheoreticTransformNat<VecType>::InverseTransformFromBitReverseInPlace(
+    const VecType& rootOfUnityInverseTable, const VecType& preconRootOfUnityInverseTable, const IntType& cycloOrderInv,
+    const IntType& preconCycloOrderInv, const std::vector<VecType*>& elements) {
+    if (!elements.empty())
+        InverseTransformFromBitReverseInPlaceKernel(rootOfUnityInverseTable, preconRootOfUnityInverseTable,
+                                                    cycloOrderInv, preconCycloOrderInv, elements);
+}
+
+template <typename VecType>
+template <typename Batch>
+void NumberTheoreticTransformNat<VecType>::InverseTransformFromBitReverseInPlaceKernel(
+    const VecType& rootOfUnityInverseTable, const VecType& preconRootOfUnityInverseTable, const IntType& cycloOrderInv,
+    const IntType& preconCycloOrderInv, const Batch& elements) {
     //
     // INTT based on the Gentleman-Sande (GS) butterfly
     // Inputs: element (vector of size n in bit-reversed ordering)
@@ -529,20 +555,15 @@ void NumberTheoreticTransformNat<VecType>::InverseTransformFromBitReverseInPlace
     // for (i = 0; i < n; ++i) do
     //     element[i] = element[i]*cycloOrderInv mod modulus
     //
+    // Every element of the batch is transformed inside the twiddle loop, so each twiddle
+    // factor is loaded once per batch.
+    //
 
-    auto modulus{element->GetModulus()};
-    uint32_t n(element->GetLength());
-
-    // precomputed omega[bitreversed(1)] * (n inverse). used in final stage of intt.
-    auto omega1Inv{rootOfUnityInverseTable[1].ModMulFastConst(cycloOrderInv, modulus, preconCycloOrderInv)};
-    auto preconOmega1Inv{omega1Inv.PrepModMulConst(modulus)};
-
-    // peeled off first stage for performance
-    for (uint32_t i{0}; i < n; i += 2) {
-        auto omega{rootOfUnityInverseTable[(i + n) >> 1]};
-        auto preconOmega{preconRootOfUnityInverseTable[(i + n) >> 1]};
-        auto loVal{(*element)[i + 0]};
-        auto hiVal{(*element)[i + 1]};
+    const auto modulus{elements[0]->GetModulus()};
+    const uint32_t n(elements[0]->GetLength());
+    auto butterfly = [&modulus](IntType& lo, IntType& hi, const IntType& omega, const IntType& preconOmega) {
+        auto loVal{lo};
+        auto hiVal{hi};
 #if defined(__GNUC__) && !defined(__clang__)
         auto omegaFactor{loVal};
         if (omegaFactor < hiVal)
@@ -552,41 +573,36 @@ void NumberTheoreticTransformNat<VecType>::InverseTransformFromBitReverseInPlace
         if (loVal >= modulus)
             loVal -= modulus;
         omegaFactor.ModMulFastConstEq(omega, modulus, preconOmega);
-        (*element)[i + 0] = loVal;
-        (*element)[i + 1] = omegaFactor;
+        lo = loVal;
+        hi = omegaFactor;
 #else
-        auto omegaFactor{loVal + (hiVal > loVal ? modulus : 0) - hiVal};
-        loVal += hiVal - (hiVal >= (modulus - loVal) ? modulus : 0);
-        (*element)[i + 0] = loVal;
+        lo += hiVal - (hiVal >= (modulus - loVal) ? modulus : 0);
+        auto omegaFactor = loVal + (hiVal > loVal ? modulus : 0) - hiVal;
         omegaFactor.ModMulFastConstEq(omega, modulus, preconOmega);
-        (*element)[i + 1] = omegaFactor;
+        hi = omegaFactor;
 #endif
+    };
+
+    // precomputed omega[bitreversed(1)] * (n inverse). used in final stage of intt.
+    auto omega1Inv{rootOfUnityInverseTable[1].ModMulFastConst(cycloOrderInv, modulus, preconCycloOrderInv)};
+    auto preconOmega1Inv{omega1Inv.PrepModMulConst(modulus)};
+
+    // peeled off first stage for performance
+    for (uint32_t i{0}; i < n; i += 2) {
+        auto omega{rootOfUnityInverseTable[(i + n) >> 1]};
+        auto preconOmega{preconRootOfUnityInverseTable[(i + n) >> 1]};
+        for (size_t k{0}; k < elements.size(); ++k)
+            butterfly((*elements[k])[i + 0], (*elements[k])[i + 1], omega, preconOmega);
     }
     // inner stages
     for (uint32_t m{n >> 2}, t{2}, logt{2}; m > 1; m >>= 1, t <<= 1, ++logt) {
         for (uint32_t i{0}; i < m; ++i) {
             auto omega{rootOfUnityInverseTable[i + m]};
             auto preconOmega{preconRootOfUnityInverseTable[i + m]};
-            for (uint32_t j1{i << logt}, j2{j1 + t}; j1 < j2; ++j1) {
-                auto loVal{(*element)[j1 + 0]};
-                auto hiVal{(*element)[j1 + t]};
-#if defined(__GNUC__) && !defined(__clang__)
-                auto omegaFactor{loVal};
-                if (omegaFactor < hiVal)
-                    omegaFactor += modulus;
-                omegaFactor -= hiVal;
-                loVal += hiVal;
-                if (loVal >= modulus)
-                    loVal -= modulus;
-                omegaFactor.ModMulFastConstEq(omega, modulus, preconOmega);
-                (*element)[j1 + 0] = loVal;
-                (*element)[j1 + t] = omegaFactor;
-#else
-                (*element)[j1 + 0] += hiVal - (hiVal >= (modulus - loVal) ? modulus : 0);
-                auto omegaFactor = loVal + (hiVal > loVal ? modulus : 0) - hiVal;
-                omegaFactor.ModMulFastConstEq(omega, modulus, preconOmega);
-                (*element)[j1 + t] = omegaFactor;
-#endif
+            for (size_t k{0}; k < elements.size(); ++k) {
+                auto& element{*elements[k]};
+                for (uint32_t j1{i << logt}, j2{j1 + t}; j1 < j2; ++j1)
+                    butterfly(element[j1 + 0], element[j1 + t], omega, preconOmega);
             }
         }
     }
@@ -595,30 +611,14 @@ void NumberTheoreticTransformNat<VecType>::InverseTransformFromBitReverseInPlace
     // by (n inverse) are incorporated into the omegaFactor calculation.
     // Please see https://github.com/openfheorg/openfhe-development/issues/872 for details.
     uint32_t j2{n >> 1};
-    for (uint32_t j1{0}; j1 < j2; ++j1) {
-        auto loVal{(*element)[j1]};
-        auto hiVal{(*element)[j1 + j2]};
-#if defined(__GNUC__) && !defined(__clang__)
-        auto omegaFactor{loVal};
-        if (omegaFactor < hiVal)
-            omegaFactor += modulus;
-        omegaFactor -= hiVal;
-        loVal += hiVal;
-        if (loVal >= modulus)
-            loVal -= modulus;
-        omegaFactor.ModMulFastConstEq(omega1Inv, modulus, preconOmega1Inv);
-        (*element)[j1 + 0]  = loVal;
-        (*element)[j1 + j2] = omegaFactor;
-#else
-        (*element)[j1] += hiVal - (hiVal >= (modulus - loVal) ? modulus : 0);
-        auto omegaFactor = loVal + (hiVal > loVal ? modulus : 0) - hiVal;
-        omegaFactor.ModMulFastConstEq(omega1Inv, modulus, preconOmega1Inv);
-        (*element)[j1 + j2] = omegaFactor;
-#endif
+    for (size_t k{0}; k < elements.size(); ++k) {
+        auto& element{*elements[k]};
+        for (uint32_t j1{0}; j1 < j2; ++j1)
+            butterfly(element[j1], element[j1 + j2], omega1Inv, preconOmega1Inv);
+        // perform remaining n/2 scalar multiplies by (n inverse)
+        for (uint32_t i = 0; i < j2; ++i)
+            element[i].ModMulFastConstEq(cycloOrderInv, modulus, preconCycloOrderInv);
     }
-    // perform remaining n/2 scalar multiplies by (n inverse)
-    for (uint32_t i = 0; i < j2; ++i)
-        (*element)[i].ModMulFastConstEq(cycloOrderInv, modulus, preconCycloOrderInv);
 }
 
 template <typename VecType>
@@ -645,26 +645,10 @@ template <typename VecType>
 void ChineseRemainderTransformFTTNat<VecType>::ForwardTransformToBitReverseInPlace(const IntType& rootOfUnity,
                                                                                    const usint CycloOrder,
                                                                                    VecType* element) {
-    if (rootOfUnity == IntType(1) || rootOfUnity == IntType(0)) {
+    if (!PrepareInPlace(rootOfUnity, CycloOrder, &element, 1))
         return;
-    }
-
-    if (!IsPowerOfTwo(CycloOrder)) {
-        OPENFHE_THROW("CyclotomicOrder is not a power of two");
-    }
-
-    usint CycloOrderHf = (CycloOrder >> 1);
-    if (element->GetLength() != CycloOrderHf) {
-        OPENFHE_THROW("element size must be equal to CyclotomicOrder / 2");
-    }
 
     IntType modulus = element->GetModulus();
-
-    auto mapSearch = m_rootOfUnityReverseTableByModulus.find(modulus);
-    if (mapSearch == m_rootOfUnityReverseTableByModulus.end() || mapSearch->second.GetLength() != CycloOrderHf) {
-        PreCompute(rootOfUnity, CycloOrder, modulus);
-    }
-
     NumberTheoreticTransformNat<VecType>().ForwardTransformToBitReverseInPlace(
         m_rootOfUnityReverseTableByModulus[modulus], m_rootOfUnityPreconReverseTableByModulus[modulus], element);
 }
@@ -705,8 +689,47 @@ template <typename VecType>
 void ChineseRemainderTransformFTTNat<VecType>::InverseTransformFromBitReverseInPlace(const IntType& rootOfUnity,
                                                                                      const usint CycloOrder,
                                                                                      VecType* element) {
-    if (rootOfUnity == IntType(1) || rootOfUnity == IntType(0)) {
+    if (!PrepareInPlace(rootOfUnity, CycloOrder, &element, 1))
         return;
+
+    IntType modulus = element->GetModulus();
+    usint msb       = GetMSB((CycloOrder >> 1) - 1);
+    NumberTheoreticTransformNat<VecType>().InverseTransformFromBitReverseInPlace(
+        m_rootOfUnityInverseReverseTableByModulus[modulus], m_rootOfUnityInversePreconReverseTableByModulus[modulus],
+        m_cycloOrderInverseTableByModulus[modulus][msb], m_cycloOrderInversePreconTableByModulus[modulus][msb],
+        element);
+}
+
+template <typename VecType>
+void ChineseRemainderTransformFTTNat<VecType>::ForwardTransformToBitReverseInPlace(
+    const IntType& rootOfUnity, const usint CycloOrder, const std::vector<VecType*>& elements) {
+    if (elements.empty() || !PrepareInPlace(rootOfUnity, CycloOrder, elements.data(), elements.size()))
+        return;
+
+    IntType modulus = elements[0]->GetModulus();
+    NumberTheoreticTransformNat<VecType>().ForwardTransformToBitReverseInPlace(
+        m_rootOfUnityReverseTableByModulus[modulus], m_rootOfUnityPreconReverseTableByModulus[modulus], elements);
+}
+
+template <typename VecType>
+void ChineseRemainderTransformFTTNat<VecType>::InverseTransformFromBitReverseInPlace(
+    const IntType& rootOfUnity, const usint CycloOrder, const std::vector<VecType*>& elements) {
+    if (elements.empty() || !PrepareInPlace(rootOfUnity, CycloOrder, elements.data(), elements.size()))
+        return;
+
+    IntType modulus = elements[0]->GetModulus();
+    usint msb       = GetMSB((CycloOrder >> 1) - 1);
+    NumberTheoreticTransformNat<VecType>().InverseTransformFromBitReverseInPlace(
+        m_rootOfUnityInverseReverseTableByModulus[modulus], m_rootOfUnityInversePreconReverseTableByModulus[modulus],
+        m_cycloOrderInverseTableByModulus[modulus][msb], m_cycloOrderInversePreconTableByModulus[modulus][msb],
+        elements);
+}
+
+template <typename VecType>
+bool ChineseRemainderTransformFTTNat<VecType>::PrepareInPlace(const IntType& rootOfUnity, const usint CycloOrder,
+                                                              VecType* const* elements, size_t count) {
+    if (rootOfUnity == IntType(1) || rootOfUnity == IntType(0)) {
+        return false;
     }
 
     if (!IsPowerOfTwo(CycloOrder)) {
@@ -714,22 +737,21 @@ void ChineseRemainderTransformFTTNat<VecType>::InverseTransformFromBitReverseInP
     }
 
     usint CycloOrderHf = (CycloOrder >> 1);
-    if (element->GetLength() != CycloOrderHf) {
-        OPENFHE_THROW("element size must be equal to CyclotomicOrder / 2");
+    IntType modulus    = elements[0]->GetModulus();
+    for (size_t i = 0; i < count; ++i) {
+        if (elements[i]->GetLength() != CycloOrderHf) {
+            OPENFHE_THROW("element size must be equal to CyclotomicOrder / 2");
+        }
+        if (elements[i]->GetModulus() != modulus) {
+            OPENFHE_THROW("all elements of a batch must have the same modulus");
+        }
     }
 
-    IntType modulus = element->GetModulus();
-
     auto mapSearch = m_rootOfUnityReverseTableByModulus.find(modulus);
     if (mapSearch == m_rootOfUnityReverseTableByModulus.end() || mapSearch->second.GetLength() != CycloOrderHf) {
         PreCompute(rootOfUnity, CycloOrder, modulus);
     }
-
-    usint msb = GetMSB(CycloOrderHf - 1);
-    NumberTheoreticTransformNat<VecType>().InverseTransformFromBitReverseInPlace(
-        m_rootOfUnityInverseReverseTableByModulus[modulus], m_rootOfUnityInversePreconReverseTableByModulus[modulus],
-        m_cycloOrderInverseTableByModulus[modulus][msb], m_cycloOrderInversePreconTableByModulus[modulus][msb],
-        element);
+    return true;
 }
 
 template <typename VecType>
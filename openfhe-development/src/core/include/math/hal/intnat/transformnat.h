@@ -239,6 +239,74 @@ public:
                                                const VecType& preconRootOfUnityInverseTable,
                                                const IntType& cycloOrderInv, const IntType& preconCycloOrderInv,
                                                VecType* element);
+
+    /**
+   * Batched version of ForwardTransformToBitReverseInPlace() for several elements
+   * that share the same modulus and ring dimension. The butterflies of all elements
+   * are interleaved, so every twiddle factor is loaded once per batch.
+   *
+   * @param &rootOfUnityTable is the table with the root of unity powers in bit
+   * reverse order.
+   * @param &preconRootOfUnityTable is NTL-specific precomputations for
+   * optimized NativeInteger modulo multiplications.
+   * @param[in,out] &elements are the inputs/outputs of the transform.
+   * @return none
+   */
+    void ForwardTransformToBitReverseInPlace(const VecType& rootOfUnityTable, const VecType& preconRootOfUnityTable,
+                                             const std::vector<VecType*>& elements);
+
+    /**
+   * Batched version of InverseTransformFromBitReverseInPlace() for several elements
+   * that share the same modulus and ring dimension. The butterflies of all elements
+   * are interleaved, so every twiddle factor is loaded once per batch.
+   *
+   * @param &rootOfUnityInverseTable is the table with the inverse 2n-th root of
+   * unity powers in bit reverse order.
+   * @param &preconRootOfUnityInverseTable is NTL-specific precomputations for
+   * optimized NativeInteger modulo multiplications.
+   * @param &cycloOrderInv is inverse of n modulo q
+   * @param &preconCycloOrderInv is NTL-specific precomputations for optimized
+   * NativeInteger modulo multiplications.
+   * @param[in,out] &elements are the inputs/outputs of the transform.
+   * @return none
+   */
+    void InverseTransformFromBitReverseInPlace(const VecType& rootOfUnityInverseTable,
+                                               const VecType& preconRootOfUnityInverseTable,
+                                               const IntType& cycloOrderInv, const IntType& preconCycloOrderInv,
+                                               const std::vector<VecType*>& elements);
+
+private:
+    /**
+   * A single element seen as a batch of compile-time size one, so the single and the batched
+   * transforms share one kernel and the single case compiles to the plain butterfly loops.
+   */
+    struct SingleElement {
+        VecType* element;
+        static constexpr size_t size() {
+            return 1;
+        }
+        VecType* operator[](size_t) const {
+            return element;
+        }
+    };
+
+    /**
+   * CT butterflies of the in-place forward transforms; the butterflies of all elements of the
+   * batch run inside the twiddle loop.
+   */
+    template <typename Batch>
+    static void ForwardTransformToBitReverseInPlaceKernel(const VecType& rootOfUnityTable,
+                                                          const VecType& preconRootOfUnityTable, const Batch& elements);
+
+    /**
+   * GS butterflies of the in-place inverse transforms; the butterflies of all elements of the
+   * batch run inside the twiddle loop.
+   */
+    template <typename Batch>
+    static void InverseTransformFromBitReverseInPlaceKernel(const VecType& rootOfUnityInverseTable,
+                                                            const VecType& preconRootOfUnityInverseTable,
+                                                            const IntType& cycloOrderInv,
+                                                            const IntType& preconCycloOrderInv, const Batch& elements);
 };
 
 /**
@@ -318,6 +386,34 @@ public:
    */
     void InverseTransformFromBitReverseInPlace(const IntType& rootOfUnity, const usint CycloOrder, VecType* element);
 
+    /**
+   * In-place Forward Transform of several elements that share the modulus q and
+   * the ring dimension n. The root of unity tables are looked up once for the batch.
+   *
+   * @param &rootOfUnity is the 2n-th root of unity in Z_q.
+   * @param CycloOrder is 2n, should be a power-of-two or a throw if an error
+   * occurs.
+   * @param[in,out] &elements are the inputs/outputs of the transform.
+   * @return none
+   * @see NumberTheoreticTransform::ForwardTransformToBitReverseInPlace()
+   */
+    void ForwardTransformToBitReverseInPlace(const IntType& rootOfUnity, const usint CycloOrder,
+                                             const std::vector<VecType*>& elements);
+
+    /**
+   * In-place Inverse Transform of several elements that share the modulus q and
+   * the ring dimension n. The root of unity tables are looked up once for the batch.
+   *
+   * @param &rootOfUnity is the 2n-th root of unity in Z_q.
+   * @param CycloOrder is 2n, should be a power-of-two or a throw if an error
+   * occurs.
+   * @param[in,out] &elements are the inputs/outputs of the transform.
+   * @return none
+   * @see NumberTheoreticTransform::InverseTransformFromBitReverseInPlace()
+   */
+    void InverseTransformFromBitReverseInPlace(const IntType& rootOfUnity, const usint CycloOrder,
+                                               const std::vector<VecType*>& elements);
+
     /**
    * Precomputation of root of unity tables for transforms in the ring
    * Z_q[X]/(X^n+1)
@@ -366,6 +462,15 @@ public:
 
     /// map to store Shoup's precomputations of inverse rou for iNTT, with bits reversed, with modulus as a key
     static std::map<IntType, VecType> m_rootOfUnityInversePreconReverseTableByModulus;
+
+private:
+    /**
+   * Checks the inputs of an in-place transform of count elements that share a modulus and
+   * precomputes the root of unity tables for that modulus if needed.
+   *
+   * @return false if rootOfUnity is 0 or 1, i.e., the transform leaves the elements unchanged
+   */
+    bool PrepareInPlace(const IntType& rootOfUnity, const usint CycloOrder, VecType* const* elements, size_t count);
 };
 
 // struct used as a key in BlueStein transform
@@ -35,6 +35,8 @@
 #include "math/math-hal.h"
 #include "utils/utilities.h"
 
+#include <algorithm>
+
 namespace lbcrypto {
 
 #if defined(HAVE_INT128)
@@ -98,6 +100,58 @@ inline uint64_t BarrettUint128ModUint64(const DoubleNativeInt& a, uint64_t modul
 
     return result;
 }
+
+/**
+ * Sum of products of 64-bit residues modulo a 64-bit modulus, accumulated in 128 bits and
+ * reduced with BarrettUint128ModUint64 only when the next product could overflow 128 bits,
+ * and once when the result is read.
+ */
+class LazyBarrettSum {
+public:
+    explicit LazyBarrettSum(const NativeInteger& modulus)
+        : m_modulus(modulus.ConvertToInt<uint64_t>()), m_mu(~DoubleNativeInt(0) / m_modulus) {
+        // the modulus is odd, so floor((2^128 - 1) / q) == floor(2^128 / q); every product is
+        // below 2^(2 * msb)
+        const uint32_t msb = modulus.GetMSB();
+        m_maxTerms         = (2 * msb >= 127) ? 1 : (1u << std::min<uint32_t>(127 - 2 * msb, 31));
+    }
+
+    /**
+     * Starts a new sum.
+     * @param value: initial value, below the modulus
+     */
+    void Reset(uint64_t value = 0) {
+        m_sum   = value;
+        m_count = 1;
+    }
+
+    /**
+     * Adds a * b to the sum.
+     * @param a: operand 1, below the modulus
+     * @param b: operand 2, below the modulus
+     */
+    void AddProduct(uint64_t a, uint64_t b) {
+        if (++m_count > m_maxTerms) {
+            m_sum   = BarrettUint128ModUint64(m_sum, m_modulus, m_mu);
+            m_count = 1;
+        }
+        m_sum += Mul128(a, b);
+    }
+
+    /**
+     * @return result: the sum modulo the modulus
+     */
+    uint64_t Get() const {
+        return BarrettUint128ModUint64(m_sum, m_modulus, m_mu);
+    }
+
+private:
+    uint64_t m_modulus;
+    DoubleNativeInt m_mu;
+    uint32_t m_maxTerms;
+    DoubleNativeInt m_sum{0};
+    uint32_t m_count{1};
+};
 #endif
 
 }  // namespace lbcrypto
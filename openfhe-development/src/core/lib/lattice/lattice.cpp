@@ -109,6 +109,7 @@ CEREAL_CLASS_VERSION(lbcrypto::M2Params, lbcrypto::M2Params::SerializedVersion()
 CEREAL_CLASS_VERSION(lbcrypto::M2DCRTParams, lbcrypto::M2DCRTParams::SerializedVersion());
 CEREAL_CLASS_VERSION(lbcrypto::M2Poly, lbcrypto::M2Poly::SerializedVersion());
 CEREAL_CLASS_VERSION(lbcrypto::M2DCRTPoly, lbcrypto::M2DCRTPoly::SerializedVersion());
+CEREAL_CLASS_VERSION(lbcrypto::DCRTModuleImpl<M2Vector>, lbcrypto::DCRTModuleImpl<M2Vector>::SerializedVersion());
 #endif
 
 //---------------------------------------------------------------------------------------------
@@ -144,6 +145,7 @@ CEREAL_CLASS_VERSION(lbcrypto::M4Params, lbcrypto::M4Params::SerializedVersion()
 CEREAL_CLASS_VERSION(lbcrypto::M4DCRTParams, lbcrypto::M4DCRTParams::SerializedVersion());
 CEREAL_CLASS_VERSION(lbcrypto::M4Poly, lbcrypto::M4Poly::SerializedVersion());
 CEREAL_CLASS_VERSION(lbcrypto::M4DCRTPoly, lbcrypto::M4DCRTPoly::SerializedVersion());
+CEREAL_CLASS_VERSION(lbcrypto::DCRTModuleImpl<M4Vector>, lbcrypto::DCRTModuleImpl<M4Vector>::SerializedVersion());
 #endif
 
 //---------------------------------------------------------------------------------------------
@@ -179,4 +181,5 @@ CEREAL_CLASS_VERSION(lbcrypto::M6Params, lbcrypto::M6Params::SerializedVersion()
 CEREAL_CLASS_VERSION(lbcrypto::M6DCRTParams, lbcrypto::M6DCRTParams::SerializedVersion());
 CEREAL_CLASS_VERSION(lbcrypto::M6Poly, lbcrypto::M6Poly::SerializedVersion());
 CEREAL_CLASS_VERSION(lbcrypto::M6DCRTPoly, lbcrypto::M6DCRTPoly::SerializedVersion());
+CEREAL_CLASS_VERSION(lbcrypto::DCRTModuleImpl<M6Vector>, lbcrypto::DCRTModuleImpl<M6Vector>::SerializedVersion());
 #endif
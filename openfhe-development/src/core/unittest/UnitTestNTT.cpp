@@ -111,3 +111,35 @@ void switch_format_simple_double_crt(const std::string& msg) {
 TEST(UTNTT, switch_format_simple_double_crt) {
     RUN_BIG_DCRTPOLYS(switch_format_simple_double_crt, "switch_format_simple_double_crt")
 }
+
+TEST(UTNTT, switch_format_batch_native) {
+    usint m    = 64;
+    usint bits = 28;
+
+    auto params = std::make_shared<ILNativeParams>(m, bits);
+    NativePoly::DugType dug;
+
+    std::vector<NativePoly> batch;
+    for (size_t i = 0; i < 3; ++i)
+        batch.emplace_back(dug, params, Format::COEFFICIENT);
+    std::vector<NativePoly> expected(batch);
+
+    std::vector<NativePoly*> ptrs;
+    for (auto& p : batch)
+        ptrs.push_back(&p);
+
+    // batched forward transform matches the single-polynomial transform
+    NativePoly::SwitchFormat(ptrs);
+    for (size_t i = 0; i < batch.size(); ++i) {
+        expected[i].SwitchFormat();
+        EXPECT_EQ(expected[i], batch[i]) << "forward batch element " << i;
+    }
+
+    // batched inverse transform matches as well
+    NativePoly::SwitchFormat(ptrs);
+    for (size_t i = 0; i < batch.size(); ++i) {
+        expected[i].SwitchFormat();
+        EXPECT_EQ(expected[i], batch[i]) << "inverse batch element " << i;
+        EXPECT_EQ(Format::COEFFICIENT, batch[i].GetFormat());
+    }
+}
@@ -578,6 +578,10 @@ public:
         ar(cereal::make_nvp("e", encodingType));
         ar(cereal::make_nvp("sl", m_slots));
         ar(cereal::make_nvp("m", m_metadataMap));
+
+        // the elements come with their own copies of parameters the context already holds
+        if (this->context)
+            this->GetCryptoParameters()->InternElementParams(m_elements);
     }
 
     std::string SerializedObjectName() const {
@@ -40,6 +40,7 @@
 #include "scheme/ckksrns/ckksrns-ser.h"
 #include "scheme/bgvrns/bgvrns-ser.h"
 #include "scheme/bfvrns/bfvrns-ser.h"
+#include "scheme/ckksmod/ckksmod-ser.h"
 
 #include <map>
 #include <memory>
@@ -48,6 +49,8 @@
 
 CEREAL_CLASS_VERSION(lbcrypto::CryptoContextImpl<lbcrypto::DCRTPoly>,
                      lbcrypto::CryptoContextImpl<lbcrypto::DCRTPoly>::SerializedVersion());
+CEREAL_CLASS_VERSION(lbcrypto::CryptoContextImpl<lbcrypto::DCRTModule>,
+                     lbcrypto::CryptoContextImpl<lbcrypto::DCRTModule>::SerializedVersion());
 
 // the routines below are only instantiated if the user includes the appropriate
 // serialize-*.h file
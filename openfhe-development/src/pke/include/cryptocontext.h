@@ -1731,13 +1731,48 @@ public:
    * operator for CKKSMod
    * the new evaluation keys are stored in cryptocontext
    * @param key secret key
+   * @param tagReducedKey if true, the reduced key and the ciphertexts reduced with the returned key get the
+   * tag <tag>-rank<newRank>, so evaluation keys of the reduced key can live in the same context as those of
+   * key; otherwise they keep the tag of key
    */
-    EvalKey<Element> EvalRankRedKeyGen(const PrivateKey<Element> key, PrivateKey<Element>& reducedKey, usint newRank);
+    EvalKey<Element> EvalRankRedKeyGen(const PrivateKey<Element> key, PrivateKey<Element>& reducedKey, usint newRank,
+                                       bool tagReducedKey = false);
 
     Ciphertext<Element> EvalRankReduce(ConstCiphertext<Element> ciphertext, EvalKey<Element> reduceKey) const {
         return GetScheme()->EvalRankReduce(ciphertext, reduceKey);
     }
 
+    /**
+   * EvalRankReduceBatch applies EvalRankReduce to many ciphertexts that share one reduce key
+   * @param ciphertexts the ciphertexts to reduce; their levels may differ
+   * @param reduceKey key generated by EvalRankRedKeyGen
+   * @return the reduced ciphertexts, in the order of the inputs
+   */
+    std::vector<Ciphertext<Element>> EvalRankReduceBatch(const std::vector<ConstCiphertext<Element>>& ciphertexts,
+                                                         EvalKey<Element> reduceKey) const {
+        return GetScheme()->EvalRankReduceBatch(ciphertexts, reduceKey);
+    }
+
+    /**
+   * EvalRankExtendKeyGen creates a key to be used for EvalRankExtend operation
+   * operator for CKKSMod
+   * @param key secret key of the lower rank, e.g. the reduced key of EvalRankRedKeyGen
+   * @param extendedKey secret key of the higher rank
+   * @return the key switching key from key to extendedKey
+   */
+    EvalKey<Element> EvalRankExtendKeyGen(const PrivateKey<Element> key, const PrivateKey<Element> extendedKey);
+
+    /**
+   * EvalRankExtend raises the rank of a ciphertext, so it can be combined with ciphertexts
+   * under the extended key
+   * @param ciphertext ciphertext under the lower-rank key
+   * @param extendKey key generated by EvalRankExtendKeyGen
+   * @return the ciphertext under the extended key
+   */
+    Ciphertext<Element> EvalRankExtend(ConstCiphertext<Element> ciphertext, EvalKey<Element> extendKey) const {
+        return GetScheme()->EvalRankExtend(ciphertext, extendKey);
+    }
+
     /**
    * EvalMultsKeyGen creates a vector evalmult keys that can be used with the
    * OpenFHE EvalMult operator 1st key (for s^2) is used for multiplication of
@@ -1923,6 +1958,27 @@ public:
         return GetScheme()->EvalMultAndRelinearize(ciphertext1, ciphertext2, evalKeyVec);
     }
 
+    /**
+   * Homomorphic squaring of a ciphertext followed by relinearization to the lowest level
+   * @param ciphertext input ciphertext.
+   * @return new ciphertext
+   */
+    Ciphertext<Element> EvalSquareAndRelinearize(ConstCiphertext<Element> ciphertext) const {
+        // input parameter check
+        if (!ciphertext)
+            OPENFHE_THROW("Input ciphertext is nullptr");
+
+        const auto evalKeyVec = CryptoContextImpl<Element>::GetEvalMultKeyVector(ciphertext->GetKeyTag());
+
+        if (evalKeyVec.size() < (2 * ciphertext->NumberCiphertextElements() - 3)) {
+            OPENFHE_THROW(
+                "Insufficient value was used for maxRelinSkDeg to generate "
+                "keys for EvalSquare");
+        }
+
+        return GetScheme()->EvalSquareAndRelinearize(ciphertext, evalKeyVec);
+    }
+
     /**
    * Multiplication of a ciphertext by a plaintext
    * @param ciphertext multiplier
@@ -2225,6 +2281,26 @@ public:
         return GetScheme()->EvalFastRotation(ciphertext, index, m, digits);
     }
 
+    /**
+   * EvalFastRotationBatch performs the automorphism and key switching step of
+   * hoisted automorphisms for many rotation indices of the same ciphertext.
+   * The digits are decomposed once by EvalFastRotationPrecompute and shared
+   * by all indices; schemes may also share the key switching work.
+   *
+   * @param ciphertext the input ciphertext to perform the automorphisms on
+   * @param indexList the rotation indices. Positive indices correspond to left
+   * rotations and negative indices correspond to right rotations.
+   * @param m is the cyclotomic order
+   * @param digits the digit decomposition created by EvalFastRotationPrecompute
+   * at the precomputation step.
+   * @return the rotated ciphertexts, in the order of indexList
+   */
+    std::vector<Ciphertext<Element>> EvalFastRotationBatch(ConstCiphertext<Element> ciphertext,
+                                                           const std::vector<int32_t>& indexList, const usint m,
+                                                           const std::shared_ptr<std::vector<Element>> digits) const {
+        return GetScheme()->EvalFastRotationBatch(ciphertext, indexList, m, digits);
+    }
+
     /**
    * Only supported for hybrid key switching.
    * Performs fast (hoisted) rotation and returns the results
@@ -38,6 +38,7 @@
 #include <memory>
 #include <vector>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 // TODO: fix insert issue if SetBVector used before SetAVector
@@ -71,7 +72,10 @@ public:
    *@param &rhs key to copy from
    */
     explicit EvalKeyRelinImpl(const EvalKeyRelinImpl<Element>& rhs)
-        : EvalKeyImpl<Element>(rhs.GetCryptoContext()), m_rKey(rhs.m_rKey) {}
+        : EvalKeyImpl<Element>(rhs.GetCryptoContext()),
+          m_rKey(rhs.m_rKey),
+          m_aSeed(rhs.m_aSeed),
+          m_aSeedCols(rhs.m_aSeedCols) {}
 
     /**
    * Move constructor
@@ -79,7 +83,10 @@ public:
    *@param &rhs key to move from
    */
     explicit EvalKeyRelinImpl(EvalKeyRelinImpl<Element>&& rhs) noexcept
-        : EvalKeyImpl<Element>(rhs.GetCryptoContext()), m_rKey(std::move(rhs.m_rKey)) {}
+        : EvalKeyImpl<Element>(rhs.GetCryptoContext()),
+          m_rKey(std::move(rhs.m_rKey)),
+          m_aSeed(std::move(rhs.m_aSeed)),
+          m_aSeedCols(rhs.m_aSeedCols) {}
 
     operator bool() const {
         return static_cast<bool>(this->context) && m_rKey.size() != 0;
@@ -91,8 +98,10 @@ public:
    * @param &rhs key to copy from
    */
     EvalKeyRelinImpl<Element>& operator=(const EvalKeyRelinImpl<Element>& rhs) {
-        this->context = rhs.context;
-        this->m_rKey  = rhs.m_rKey;
+        this->context     = rhs.context;
+        this->m_rKey      = rhs.m_rKey;
+        this->m_aSeed     = rhs.m_aSeed;
+        this->m_aSeedCols = rhs.m_aSeedCols;
         return *this;
     }
 
@@ -105,6 +114,8 @@ public:
         this->context = rhs.context;
         rhs.context   = 0;
         m_rKey        = std::move(rhs.m_rKey);
+        m_aSeed       = std::move(rhs.m_aSeed);
+        m_aSeedCols   = rhs.m_aSeedCols;
         return *this;
     }
 
@@ -138,6 +149,27 @@ public:
         return m_rKey.at(0);
     }
 
+    /**
+   * Records the PRNG seed the Relinearization Element Vector A was sampled from.
+   * Keys with a seed are serialized without A; it is regenerated from the seed
+   * when the key is loaded.
+   *
+   * @param &seed is the seed of A.
+   * @param cols is the number of columns of every element of A.
+   */
+    void SetAVectorSeed(const std::vector<uint32_t>& seed, uint32_t cols) {
+        m_aSeed     = seed;
+        m_aSeedCols = cols;
+    }
+
+    const std::vector<uint32_t>& GetAVectorSeed() const {
+        return m_aSeed;
+    }
+
+    uint32_t GetAVectorSeedCols() const {
+        return m_aSeedCols;
+    }
+
     /**
    * Setter function to store Relinearization Element Vector B.
    * Overrides base class implementation.
@@ -235,6 +267,7 @@ public:
     virtual void ClearKeys() {
         m_rKey.clear();
         m_dcrtKeys.clear();
+        m_aSeed.clear();
     }
 
     bool key_compare(const EvalKeyImpl<Element>& other) const {
@@ -243,6 +276,9 @@ public:
         if (!CryptoObject<Element>::operator==(other))
             return false;
 
+        if (this->m_aSeed != oth.m_aSeed || this->m_aSeedCols != oth.m_aSeedCols)
+            return false;
+
         if (this->m_rKey.size() != oth.m_rKey.size())
             return false;
         for (size_t i = 0; i < this->m_rKey.size(); i++) {
@@ -259,7 +295,19 @@ public:
     template <class Archive>
     void save(Archive& ar, std::uint32_t const version) const {
         ar(::cereal::base_class<EvalKeyImpl<Element>>(this));
-        ar(::cereal::make_nvp("k", m_rKey));
+        if (version < 2) {
+            ar(::cereal::make_nvp("k", m_rKey));
+            return;
+        }
+        // seed-compressed keys only store B and the seed of A
+        ar(::cereal::make_nvp("s", m_aSeed));
+        if (m_aSeed.empty()) {
+            ar(::cereal::make_nvp("k", m_rKey));
+        }
+        else {
+            ar(::cereal::make_nvp("sc", m_aSeedCols));
+            ar(::cereal::make_nvp("b", m_rKey.at(1)));
+        }
     }
 
     template <class Archive>
@@ -269,13 +317,36 @@ public:
                           " is from a later version of the library");
         }
         ar(::cereal::base_class<EvalKeyImpl<Element>>(this));
-        ar(::cereal::make_nvp("k", m_rKey));
+        if (version < 2) {
+            ar(::cereal::make_nvp("k", m_rKey));
+            return;
+        }
+        ar(::cereal::make_nvp("s", m_aSeed));
+        if (m_aSeed.empty()) {
+            ar(::cereal::make_nvp("k", m_rKey));
+        }
+        else {
+            std::vector<Element> b;
+            ar(::cereal::make_nvp("sc", m_aSeedCols));
+            ar(::cereal::make_nvp("b", b));
+            if constexpr (std::is_same_v<Element, DCRTModule>) {
+                if (b.empty())
+                    OPENFHE_THROW("Seed-compressed key without B");
+                // A is expanded once here rather than on every key switch
+                std::vector<Element> a =
+                    Element::SampleUniform(m_aSeed, b.size(), b[0].GetParams(), b[0].GetModuleRows(), m_aSeedCols);
+                m_rKey = {std::move(a), std::move(b)};
+            }
+            else {
+                OPENFHE_THROW("Seed-compressed keys are only supported for DCRTModule");
+            }
+        }
     }
     std::string SerializedObjectName() const {
         return "EvalKeyRelin";
     }
     static uint32_t SerializedVersion() {
-        return 1;
+        return 2;
     }
 
 private:
@@ -284,6 +355,10 @@ private:
 
     // Used for hybrid key switching
     std::vector<DCRTPoly> m_dcrtKeys;
+
+    // PRNG seed of A for seed-compressed keys; empty otherwise
+    std::vector<uint32_t> m_aSeed;
+    uint32_t m_aSeedCols = 0;
 };
 
 }  // namespace lbcrypto
@@ -45,4 +45,14 @@ CEREAL_REGISTER_TYPE(lbcrypto::EvalKeyRelinImpl<lbcrypto::DCRTPoly>);
 CEREAL_REGISTER_POLYMORPHIC_RELATION(lbcrypto::EvalKeyImpl<lbcrypto::DCRTPoly>,
                                      lbcrypto::EvalKeyRelinImpl<lbcrypto::DCRTPoly>);
 
+CEREAL_REGISTER_TYPE(lbcrypto::EvalKeyImpl<lbcrypto::DCRTModule>);
+CEREAL_REGISTER_TYPE(lbcrypto::EvalKeyRelinImpl<lbcrypto::DCRTModule>);
+
+CEREAL_REGISTER_POLYMORPHIC_RELATION(lbcrypto::EvalKeyImpl<lbcrypto::DCRTModule>,
+                                     lbcrypto::EvalKeyRelinImpl<lbcrypto::DCRTModule>);
+
+// module keys may be seed-compressed; keys over other elements keep the original layout
+CEREAL_CLASS_VERSION(lbcrypto::EvalKeyRelinImpl<lbcrypto::DCRTModule>,
+                     lbcrypto::EvalKeyRelinImpl<lbcrypto::DCRTModule>::SerializedVersion());
+
 #endif
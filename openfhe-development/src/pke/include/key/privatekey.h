@@ -44,6 +44,7 @@
 #include <limits>
 #include <string>
 #include <utility>
+#include <vector>
 
 /**
  * @namespace lbcrypto
@@ -83,7 +84,8 @@ public:
    */
     explicit PrivateKeyImpl(const PrivateKeyImpl<Element>& rhs)
         : Key<Element>(rhs.GetCryptoContext(), rhs.GetKeyTag()) {
-        this->m_sk = rhs.m_sk;
+        this->m_sk     = rhs.m_sk;
+        this->m_powers = std::atomic_load(&rhs.m_powers);
     }
 
     /**
@@ -91,7 +93,8 @@ public:
    *@param &rhs the PrivateKeyImpl to move from
    */
     explicit PrivateKeyImpl(PrivateKeyImpl<Element>&& rhs) : Key<Element>(rhs.GetCryptoContext(), rhs.GetKeyTag()) {
-        this->m_sk = std::move(rhs.m_sk);
+        this->m_sk     = std::move(rhs.m_sk);
+        this->m_powers = std::atomic_exchange(&rhs.m_powers, PowersPtr());
     }
 
     operator bool() const {
@@ -107,6 +110,7 @@ public:
     const PrivateKeyImpl<Element>& operator=(const PrivateKeyImpl<Element>& rhs) {
         CryptoObject<Element>::operator=(rhs);
         this->m_sk = rhs.m_sk;
+        std::atomic_store(&this->m_powers, std::atomic_load(&rhs.m_powers));
         return *this;
     }
 
@@ -119,6 +123,7 @@ public:
     const PrivateKeyImpl<Element>& operator=(PrivateKeyImpl<Element>&& rhs) {
         CryptoObject<Element>::operator=(rhs);
         this->m_sk = std::move(rhs.m_sk);
+        std::atomic_store(&this->m_powers, std::atomic_exchange(&rhs.m_powers, PowersPtr()));
         return *this;
     }
 
@@ -136,6 +141,7 @@ public:
    */
     void SetPrivateElement(const Element& x) {
         m_sk = x;
+        std::atomic_store(&m_powers, PowersPtr());
     }
 
     /**
@@ -144,6 +150,24 @@ public:
    */
     void SetPrivateElement(Element&& x) {
         m_sk = std::move(x);
+        std::atomic_store(&m_powers, PowersPtr());
+    }
+
+    /**
+   * Get accessor for powers of the private element, such as those needed to decrypt ciphertexts that
+   * are not relinearized. They are computed on first use and dropped when the private element changes.
+   * @param compute callable that returns the powers as a std::vector<Element>.
+   * @return the powers of the private element.
+   */
+    template <typename Compute>
+    std::shared_ptr<const std::vector<Element>> GetPrivateElementPowers(Compute&& compute) const {
+        PowersPtr powers = std::atomic_load(&m_powers);
+        if (!powers) {
+            // two threads may both compute the powers; either result is valid
+            powers = std::make_shared<const std::vector<Element>>(compute());
+            std::atomic_store(&m_powers, powers);
+        }
+        return powers;
     }
 
     bool operator==(const PrivateKeyImpl& other) const {
@@ -168,6 +192,7 @@ public:
         }
         ar(::cereal::base_class<Key<Element>>(this));
         ar(::cereal::make_nvp("s", m_sk));
+        std::atomic_store(&m_powers, PowersPtr());
     }
 
     std::string SerializedObjectName() const {
@@ -178,7 +203,11 @@ public:
     }
 
 private:
+    using PowersPtr = std::shared_ptr<const std::vector<Element>>;
+
     Element m_sk;
+    // not serialized, recomputed on demand
+    mutable PowersPtr m_powers;
 };
 
 }  // namespace lbcrypto
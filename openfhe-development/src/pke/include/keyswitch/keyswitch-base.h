@@ -116,6 +116,16 @@ public:
         OPENFHE_THROW("KeySwitchCore is not supported");
     }
 
+    virtual std::shared_ptr<std::vector<Element>> KeySwitchCoreMany(
+        const Element& a, const std::vector<EvalKey<Element>>& evalKeys) const {
+        OPENFHE_THROW("KeySwitchCoreMany is not supported");
+    }
+
+    virtual std::vector<std::shared_ptr<std::vector<Element>>> KeySwitchCoreBatch(
+        const std::vector<Element>& a, const EvalKey<Element> evalKey) const {
+        OPENFHE_THROW("KeySwitchCoreBatch is not supported");
+    }
+
     virtual std::shared_ptr<std::vector<Element>> EvalKeySwitchPrecomputeCore(
         const Element& c, std::shared_ptr<CryptoParametersBase<Element>> cryptoParamsBase) const {
         OPENFHE_THROW("EvalKeySwitchPrecomputeCore is not supported");
@@ -132,6 +142,12 @@ public:
         const std::shared_ptr<ParmType> paramsQl) const {
         OPENFHE_THROW("EvalFastKeySwitchCoreExt is not supported");
     }
+
+    virtual std::vector<std::shared_ptr<std::vector<Element>>> EvalFastKeySwitchCoreBatch(
+        const std::shared_ptr<std::vector<Element>> digits, const std::vector<EvalKey<Element>>& evalKeys,
+        const std::shared_ptr<ParmType> paramsQl) const {
+        OPENFHE_THROW("EvalFastKeySwitchCoreBatch is not supported");
+    }
 };
 
 }  // namespace lbcrypto
@@ -73,6 +73,22 @@ public:
     EvalKey<DCRTModule> KeySwitchGenInternal(const PrivateKey<DCRTModule> oldPrivateKey,
                                              const PrivateKey<DCRTModule> newPrivateKey) const override;
 
+    /**
+   * Generates a seed-compressed key switching key from the given seeds: A is expanded from aSeed,
+   * which is stored with the key, and the errors are sampled from errorSeed, which must stay
+   * secret. The key depends only on the secrets and the seeds, not on the number of threads.
+   *
+   * @param oldPrivateKey the key switched from
+   * @param newPrivateKey the key switched to
+   * @param aSeed the public seed of A, of at most Blake2Engine::MAX_SEED_GENS words
+   * @param errorSeed the secret seed of the errors, of at most Blake2Engine::MAX_SEED_GENS words
+   * @return the key switching key
+   */
+    EvalKey<DCRTModule> KeySwitchGenSeeded(const PrivateKey<DCRTModule> oldPrivateKey,
+                                           const PrivateKey<DCRTModule> newPrivateKey,
+                                           const std::vector<uint32_t>& aSeed,
+                                           const std::vector<uint32_t>& errorSeed) const;
+
     void KeySwitchInPlace(Ciphertext<DCRTModule>& ciphertext, const EvalKey<DCRTModule> ek) const;
 
     std::shared_ptr<std::vector<DCRTModule>> EvalKeySwitchPrecomputeCore(
@@ -82,13 +98,72 @@ public:
         const std::shared_ptr<std::vector<DCRTModule>> digits, const EvalKey<DCRTModule> evalKey,
         const std::shared_ptr<ParmType> paramsQl) const;
 
+    /**
+   * Key switches the digits of a module whose columns are split among several keys and
+   * runs a single ApproxModDown pair on the accumulated result.
+   *
+   * @param digits the digits of the extended module, see EvalKeySwitchPrecomputeCore
+   * @param evalKeys evalKeys[k] switches the next (rows of its b vector) columns
+   * @param paramsQl the basis of the module that was decomposed
+   * @return the pair of components in basis Q_l
+   */
+    std::shared_ptr<std::vector<DCRTModule>> EvalFastKeySwitchCore(
+        const std::shared_ptr<std::vector<DCRTModule>> digits, const std::vector<EvalKey<DCRTModule>>& evalKeys,
+        const std::shared_ptr<ParmType> paramsQl) const;
+
     std::shared_ptr<std::vector<DCRTModule>> EvalFastKeySwitchCoreExt(
         const std::shared_ptr<std::vector<DCRTModule>> digits, const EvalKey<DCRTModule> evalKey,
         const std::shared_ptr<ParmType> paramsQl) const;
 
+    /**
+   * Accumulates the inner products of the digits with all keys in the extended basis Q_l*P,
+   * walking the columns of the digits key by key.
+   */
+    std::shared_ptr<std::vector<DCRTModule>> EvalFastKeySwitchCoreExt(
+        const std::shared_ptr<std::vector<DCRTModule>> digits, const std::vector<EvalKey<DCRTModule>>& evalKeys,
+        const std::shared_ptr<ParmType> paramsQl) const;
+
+    /**
+   * Key switches the same digits with many keys, e.g. for several rotations of one ciphertext.
+   * The inner products are computed for blocks of keys, so every digit coefficient is read once
+   * per block rather than once per key.
+   *
+   * @param digits the digits of the module, see EvalKeySwitchPrecomputeCore
+   * @param evalKeys the keys, each switching all columns of the digits
+   * @param paramsQl the basis of the module that was decomposed
+   * @return for every key, the pair of components in basis Q_l
+   */
+    std::vector<std::shared_ptr<std::vector<DCRTModule>>> EvalFastKeySwitchCoreBatch(
+        const std::shared_ptr<std::vector<DCRTModule>> digits, const std::vector<EvalKey<DCRTModule>>& evalKeys,
+        const std::shared_ptr<ParmType> paramsQl) const override;
+
     std::shared_ptr<std::vector<DCRTModule>> KeySwitchCore(const DCRTModule& a,
                                                            const EvalKey<DCRTModule> evalKey) const override;
 
+    /**
+   * Key switches a module whose columns come from several components, e.g. the Hadamard and
+   * the lower-triangle parts of a product ciphertext. The whole module is decomposed once,
+   * both inner products are accumulated in Q_l*P and only one ApproxModDown pair is run.
+   *
+   * @param a the concatenated components in basis Q_l
+   * @param evalKeys evalKeys[k] switches the next (rows of its b vector) columns of a
+   * @return the pair of components to be added to the first two ciphertext elements
+   */
+    std::shared_ptr<std::vector<DCRTModule>> KeySwitchCoreMany(
+        const DCRTModule& a, const std::vector<EvalKey<DCRTModule>>& evalKeys) const override;
+
+    /**
+   * Key switches many modules with the same key. The modules are decomposed in parallel and the
+   * inner products are computed for blocks of modules at the same level, so every key entry is
+   * read once per block rather than once per module.
+   *
+   * @param a the modules to key switch, each with as many columns as the key has rows
+   * @param evalKey the shared key switching key
+   * @return for every module, the pair of components in its basis Q_l
+   */
+    std::vector<std::shared_ptr<std::vector<DCRTModule>>> KeySwitchCoreBatch(
+        const std::vector<DCRTModule>& a, const EvalKey<DCRTModule> evalKey) const override;
+
     /////////////////////////////////////////
     // SERIALIZATION
     /////////////////////////////////////////
@@ -106,6 +181,16 @@ public:
     std::string SerializedObjectName() const {
         return "KeySwitchMod";
     }
+
+private:
+    /**
+   * Generates a key switching key. A is copied from ekPrev if it is given, expanded from aSeed if
+   * it is not empty and drawn from the uniform generator otherwise; the errors come from errorSeed.
+   */
+    EvalKey<DCRTModule> KeySwitchGenFromSeeds(const PrivateKey<DCRTModule> oldPrivateKey,
+                                              const PrivateKey<DCRTModule> newPrivateKey,
+                                              const EvalKey<DCRTModule> ekPrev, const std::vector<uint32_t>& aSeed,
+                                              const std::vector<uint32_t>& errorSeed) const;
 };
 
 }  // namespace lbcrypto
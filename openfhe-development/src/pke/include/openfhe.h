@@ -73,6 +73,7 @@
 #include "gen-cryptocontext.h"
 #include "scheme/ckksrns/gen-cryptocontext-ckksrns.h"
 #include "scheme/ckksmod/gen-cryptocontext-ckksmod.h"
+#include "scheme/ckksmod/ckksmod-convert.h"
 #include "scheme/bfvrns/gen-cryptocontext-bfvrns.h"
 #include "scheme/bgvrns/gen-cryptocontext-bgvrns.h"
 
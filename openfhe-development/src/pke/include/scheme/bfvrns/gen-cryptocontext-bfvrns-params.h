@@ -94,6 +94,9 @@ public:
     void SetInteractiveBootCompressionLevel(COMPRESSION_LEVEL interactiveBootCompressionLevel0) override {
         DISABLED_FOR_BFVRNS;
     }
+    void SetCompressEvalKeys(bool compressEvalKeys0) override {
+        DISABLED_FOR_BFVRNS;
+    }
 };
 //====================================================================================================================
 
@@ -84,6 +84,9 @@ public:
     void SetInteractiveBootCompressionLevel(COMPRESSION_LEVEL interactiveBootCompressionLevel0) override {
         DISABLED_FOR_BGVRNS;
     }
+    void SetCompressEvalKeys(bool compressEvalKeys0) override {
+        DISABLED_FOR_BGVRNS;
+    }
 };
 //====================================================================================================================
 
@@ -0,0 +1,117 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+
+/*
+  Conversion of rank-1 CKKSMod ciphertexts and keys to CKKSRNS and back
+ */
+
+#ifndef LBCRYPTO_CRYPTO_CKKSMOD_CONVERT_H
+#define LBCRYPTO_CRYPTO_CKKSMOD_CONVERT_H
+
+#include "cryptocontext.h"
+
+/**
+ * @namespace lbcrypto
+ * The namespace of lbcrypto
+ */
+namespace lbcrypto {
+
+/**
+ * Generates a CKKSRNS crypto context over the same ring and the same moduli Q as a CKKSMod
+ * context, so that rank-1 ciphertexts can move between the two without any basis change.
+ * The scaling factors of both contexts coincide level by level. The new context always uses
+ * HYBRID key switching with the number of digits of the CKKSMod context, and its moduli P must
+ * match those of a HYBRID or GHS CKKSMod context. Secret keys of BV contexts, which live in Q,
+ * are extended to QP on conversion.
+ *
+ * @param ccMod the CKKSMod crypto context
+ * @return the compatible CKKSRNS crypto context; features still have to be enabled
+ */
+CryptoContext<DCRTPoly> GenCompatibleCryptoContextCKKSRNS(const CryptoContext<DCRTModule>& ccMod);
+
+/**
+ * Converts a rank-1 CKKSMod ciphertext, e.g. the output of EvalRankReduce with newRank = 1,
+ * into a CKKSRNS ciphertext. The input pointer is released; its towers are moved if it was the
+ * only owner of the ciphertext and copied otherwise.
+ *
+ * @param ciphertext rank-1 ciphertext with two elements
+ * @param ccRNS context from GenCompatibleCryptoContextCKKSRNS
+ * @return the same ciphertext under the converted secret key
+ */
+Ciphertext<DCRTPoly> ConvertCKKSModToCKKSRNS(Ciphertext<DCRTModule>&& ciphertext, const CryptoContext<DCRTPoly>& ccRNS);
+
+/**
+ * Copying version of the conversion above.
+ */
+Ciphertext<DCRTPoly> ConvertCKKSModToCKKSRNS(ConstCiphertext<DCRTModule> ciphertext,
+                                             const CryptoContext<DCRTPoly>& ccRNS);
+
+/**
+ * Embeds a CKKSRNS ciphertext as a rank-1 CKKSMod ciphertext. The input pointer is released; its
+ * towers are moved if it was the only owner of the ciphertext and copied otherwise.
+ *
+ * @param ciphertext ciphertext with two elements
+ * @param ccMod the CKKSMod context the CKKSRNS context was generated from
+ * @return the same ciphertext as a rank-1 module ciphertext
+ */
+Ciphertext<DCRTModule> ConvertCKKSRNSToCKKSMod(Ciphertext<DCRTPoly>&& ciphertext, const CryptoContext<DCRTModule>& ccMod);
+
+/**
+ * Copying version of the embedding above.
+ */
+Ciphertext<DCRTModule> ConvertCKKSRNSToCKKSMod(ConstCiphertext<DCRTPoly> ciphertext,
+                                               const CryptoContext<DCRTModule>& ccMod);
+
+/**
+ * Converts a rank-1 CKKSMod secret key into a CKKSRNS secret key, e.g. to generate rotation
+ * or bootstrapping keys for the converted ciphertexts.
+ *
+ * @param privateKey rank-1 secret key, e.g. the reduced key of EvalRankRedKeyGen
+ * @param ccRNS context from GenCompatibleCryptoContextCKKSRNS
+ * @return the same secret key for the CKKSRNS context
+ */
+PrivateKey<DCRTPoly> ConvertCKKSModToCKKSRNS(const PrivateKey<DCRTModule>& privateKey,
+                                             const CryptoContext<DCRTPoly>& ccRNS);
+
+/**
+ * Converts a CKKSRNS secret key into a rank-1 CKKSMod secret key.
+ *
+ * @param privateKey CKKSRNS secret key
+ * @param ccMod the CKKSMod context the CKKSRNS context was generated from
+ * @return the same secret key as a rank-1 module key
+ */
+PrivateKey<DCRTModule> ConvertCKKSRNSToCKKSMod(const PrivateKey<DCRTPoly>& privateKey,
+                                               const CryptoContext<DCRTModule>& ccMod);
+
+}  // namespace lbcrypto
+
+#endif
@@ -37,6 +37,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 /**
  * @namespace lbcrypto
@@ -50,7 +51,15 @@ class CryptoParametersCKKSMod : public CryptoParametersMod {
 public:
     CryptoParametersCKKSMod() : CryptoParametersMod() {}
 
-    CryptoParametersCKKSMod(const CryptoParametersCKKSMod& rhs) : CryptoParametersMod(rhs) {}
+    // the parameter chains hold immutable parameters derived from the element parameters, which
+    // the copy shares, so they are shared as well
+    CryptoParametersCKKSMod(const CryptoParametersCKKSMod& rhs)
+        : CryptoParametersMod(rhs),
+          m_paramsQl(rhs.m_paramsQl),
+          m_paramsQlP(rhs.m_paramsQlP),
+          m_paramsLastPartQl(rhs.m_paramsLastPartQl),
+          m_scalingFactorIntCRT(rhs.m_scalingFactorIntCRT),
+          m_compressEvalKeys(rhs.m_compressEvalKeys) {}
 
     CryptoParametersCKKSMod(std::shared_ptr<ParmType> params, const PlaintextModulus& plaintextModulus,
                             float distributionParameter, float assuranceMeasure, SecurityLevel securityLevel,
@@ -93,6 +102,112 @@ public:
 
     uint64_t FindAuxPrimeStep() const override;
 
+    /**
+   * Gets the shared parameters of the prefix Q_0...Q_{sizeQl-1} of the modulus chain.
+   * Level drops adopt these so that ciphertexts at the same level share one params object.
+   *
+   * @param sizeQl number of towers of the requested prefix
+   * @return the parameters, or nullptr if the tables have not been precomputed
+   */
+    const std::shared_ptr<ParmType> GetParamsQl(size_t sizeQl) const {
+        if (sizeQl == 0 || sizeQl > m_paramsQl.size())
+            return nullptr;
+        return m_paramsQl[sizeQl - 1];
+    }
+
+    /**
+   * Checks whether params are the shared parameters of a prefix of the modulus chain, i.e.,
+   * whether level drops of an element with these params may adopt GetParamsQl.
+   *
+   * @param params the parameters of the element
+   * @return true if params is the cached prefix of the same size
+   */
+    bool HasParamsQl(const std::shared_ptr<ParmType>& params) const {
+        const size_t sizeQl = params->GetParams().size();
+        return sizeQl > 0 && GetParamsQl(sizeQl) == params;
+    }
+
+    /**
+   * Gets the shared parameters of the prefix of the modulus chain that params describe, comparing
+   * the ring dimension and all moduli, so that elements built from copies of the chain, such as
+   * deserialized ciphertexts, can share them.
+   *
+   * @param params the parameters of an element
+   * @return the cached prefix if it describes the same towers, params otherwise
+   */
+    std::shared_ptr<ParmType> InternParamsQl(const std::shared_ptr<ParmType>& params) const;
+
+    void InternElementParams(std::vector<DCRTModule>& elements) const override;
+
+    /**
+   * Gets the extended basis Q_0...Q_{sizeQl-1} * P used by hybrid key switching at a level.
+   *
+   * @param sizeQl number of towers of Q at the level
+   * @return the parameters, or nullptr if the tables have not been precomputed
+   */
+    const std::shared_ptr<ParmType> GetParamsQlP(size_t sizeQl) const {
+        if (sizeQl == 0 || sizeQl > m_paramsQlP.size())
+            return nullptr;
+        return m_paramsQlP[sizeQl - 1];
+    }
+
+    /**
+   * Gets the parameters of the last digit of the hybrid key switching decomposition at a level;
+   * the last digit holds fewer towers than a full digit when alpha does not divide sizeQl.
+   *
+   * @param sizeQl number of towers of Q at the level
+   * @return the parameters, or nullptr if the tables have not been precomputed
+   */
+    const std::shared_ptr<ParmType> GetParamsLastPartQl(size_t sizeQl) const {
+        if (sizeQl == 0 || sizeQl > m_paramsLastPartQl.size())
+            return nullptr;
+        return m_paramsLastPartQl[sizeQl - 1];
+    }
+
+    /**
+   * Gets the residues modulo q_0...q_{sizeQ-1} of the rounded scaling factor of a level, by which
+   * constants added to a ciphertext at the level are raised to its depth. Constants at level 0 of
+   * FLEXIBLEAUTOEXT are scaled by the big factor and not raised, so that entry is not used.
+   * A ciphertext at the level uses the prefix of its towers.
+   *
+   * @param level the level of the ciphertext
+   * @return the residues
+   */
+    const std::vector<NativeInteger>& GetScalingFactorIntCRT(uint32_t level) const {
+        if (level >= m_scalingFactorIntCRT.size())
+            OPENFHE_THROW("GetScalingFactorIntCRT: level " + std::to_string(level) + " is out of range");
+        return m_scalingFactorIntCRT[level];
+    }
+
+    /**
+   * Gets the scaling factor of a depth-2 ciphertext at level l, to which a ciphertext one level
+   * below is raised. The base class holds it only for the FLEXIBLEAUTO modes; with the fixed
+   * techniques all scaling factors are equal, so it is the square of the scaling factor.
+   *
+   * @param l the level
+   * @return the scaling factor of depth 2
+   */
+    double GetScalingFactorRealBig(uint32_t l = 0) const {
+        if (m_scalTechnique == FLEXIBLEAUTO || m_scalTechnique == FLEXIBLEAUTOEXT)
+            return CryptoParametersMod::GetScalingFactorRealBig(l);
+        const double scFactor = GetScalingFactorReal(l);
+        return scFactor * scFactor;
+    }
+
+    /**
+   * Checks whether key switching keys record the seed of their uniform part, so that
+   * they are serialized without it.
+   *
+   * @return true if key switching keys are seed-compressed
+   */
+    bool GetCompressEvalKeys() const {
+        return m_compressEvalKeys;
+    }
+
+    void SetCompressEvalKeys(bool compressEvalKeys) {
+        m_compressEvalKeys = compressEvalKeys;
+    }
+
     /////////////////////////////////////
     // SERIALIZATION
     /////////////////////////////////////
@@ -100,6 +215,8 @@ public:
     template <class Archive>
     void save(Archive& ar, std::uint32_t const version) const {
         ar(cereal::base_class<CryptoParametersMod>(this));
+        ar(cereal::make_nvp("mr", m_moduleRank));
+        ar(cereal::make_nvp("ck", m_compressEvalKeys));
     }
 
     template <class Archive>
@@ -110,6 +227,11 @@ public:
             OPENFHE_THROW(errMsg);
         }
         ar(cereal::base_class<CryptoParametersMod>(this));
+        // version 1 stored neither the module rank nor the key compression flag
+        if (version >= 2) {
+            ar(cereal::make_nvp("mr", m_moduleRank));
+            ar(cereal::make_nvp("ck", m_compressEvalKeys));
+        }
 
         if (PrecomputeCRTTablesAfterDeserializaton()) {
             PrecomputeCRTTables(m_ksTechnique, m_scalTechnique, m_encTechnique, m_multTechnique, m_numPartQ, m_auxBits,
@@ -121,8 +243,23 @@ public:
         return "CryptoParametersCKKSMod";
     }
     static uint32_t SerializedVersion() {
-        return 1;
+        return 2;
     }
+
+protected:
+    // m_paramsQl[l] holds the parameters of the first l + 1 towers of Q
+    std::vector<std::shared_ptr<ParmType>> m_paramsQl;
+
+    // m_paramsQlP[l] holds the first l + 1 towers of Q followed by P
+    std::vector<std::shared_ptr<ParmType>> m_paramsQlP;
+
+    // m_paramsLastPartQl[l] holds the last digit of the first l + 1 towers of Q
+    std::vector<std::shared_ptr<ParmType>> m_paramsLastPartQl;
+
+    // m_scalingFactorIntCRT[l] holds the residues of the scaling factor of constants at level l
+    std::vector<std::vector<NativeInteger>> m_scalingFactorIntCRT;
+
+    bool m_compressEvalKeys = false;
 };
 
 }  // namespace lbcrypto
@@ -54,6 +54,27 @@ public:
     void EvalSubInPlace(Ciphertext<DCRTModule>& ciphertext1,
                                            ConstCiphertext<DCRTModule> ciphertext2) const override;
 
+    /**
+   * Adds a real number to the ciphertext. The constant is scaled and reduced into its CRT
+   * residues with the per-level tables of the parameters and added to c0 in place; nothing is
+   * encoded or encrypted.
+   */
+    Ciphertext<DCRTModule> EvalAdd(ConstCiphertext<DCRTModule> ciphertext, double operand) const override;
+
+    void EvalAddInPlace(Ciphertext<DCRTModule>& ciphertext, double operand) const override;
+
+    Ciphertext<DCRTModule> EvalSub(ConstCiphertext<DCRTModule> ciphertext, double operand) const override;
+
+    void EvalSubInPlace(Ciphertext<DCRTModule>& ciphertext, double operand) const override;
+
+    /**
+   * Multiplies the ciphertext by a real number, scaled to an integer at the ciphertext level.
+   * The result has one more level of depth and needs a rescale, like a ciphertext product.
+   */
+    Ciphertext<DCRTModule> EvalMult(ConstCiphertext<DCRTModule> ciphertext, double operand) const override;
+
+    void EvalMultInPlace(Ciphertext<DCRTModule>& ciphertext, double operand) const override;
+
     Ciphertext<DCRTModule> EvalMult(ConstCiphertext<DCRTModule> ciphertext1,
                                     ConstCiphertext<DCRTModule> ciphertext2) const override;
 
@@ -65,8 +86,45 @@ public:
     Ciphertext<DCRTModule> EvalMultCore(ConstCiphertext<DCRTModule> ciphertext1,
                                         ConstCiphertext<DCRTModule> ciphertext2) const override;
 
+    Ciphertext<DCRTModule> EvalSquare(ConstCiphertext<DCRTModule> ciphertext) const override;
+
+    Ciphertext<DCRTModule> EvalSquareMutable(Ciphertext<DCRTModule>& ciphertext) const override;
+
+    Ciphertext<DCRTModule> EvalSquare(ConstCiphertext<DCRTModule> ciphertext,
+                                      const EvalKey<DCRTModule> evalKey) const override {
+        OPENFHE_THROW("EvalSquare with evalKey not supported for this scheme; use EvalSquareAndRelinearize");
+    }
+
+    void EvalSquareInPlace(Ciphertext<DCRTModule>& ciphertext, const EvalKey<DCRTModule> evalKey) const override {
+        OPENFHE_THROW("EvalSquareInPlace with evalKey not supported for this scheme; use EvalSquareAndRelinearize");
+    }
+
+    Ciphertext<DCRTModule> EvalSquareMutable(Ciphertext<DCRTModule>& ciphertext,
+                                             const EvalKey<DCRTModule> evalKey) const override {
+        OPENFHE_THROW("EvalSquareMutable with evalKey not supported for this scheme; use EvalSquareAndRelinearize");
+    }
+
+    /**
+   * Squares a ciphertext using only the distinct terms of the tensor: c0*c1 is computed once
+   * and doubled, and each pair of c1 columns is multiplied once, so the cost is about half of
+   * EvalMultCore at high rank. The layout of the result is the one of EvalMultCore.
+   */
+    Ciphertext<DCRTModule> EvalSquareCore(ConstCiphertext<DCRTModule> ciphertext) const override;
+
     void EvalMultCoreInPlace(Ciphertext<DCRTModule>& ciphertext, double operand) const;
 
+    /**
+   * Multiplies by a plaintext in Format::EVALUATION. Its polynomial is broadcast over the
+   * module entries and read in place, skipping the towers above the ciphertext level, so the
+   * product costs k+1 entry-wise products and no NTT or copy. A plaintext that must be rescaled
+   * or raised in depth first is copied, as for CKKSRNS.
+   */
+    void EvalMultInPlace(Ciphertext<DCRTModule>& ciphertext, ConstPlaintext plaintext) const override;
+
+    void EvalAddInPlace(Ciphertext<DCRTModule>& ciphertext, ConstPlaintext plaintext) const override;
+
+    void EvalSubInPlace(Ciphertext<DCRTModule>& ciphertext, ConstPlaintext plaintext) const override;
+
     EvalKey<DCRTModule> EvalMultKeyGen(const PrivateKey<DCRTModule> privateKey) const {
         OPENFHE_THROW(
             "EvalMultKeyGen not supported for this scheme use EvalMultModKeyGen instead");  // Needs more than one evalKey
@@ -74,10 +132,50 @@ public:
 
     std::vector<EvalKey<DCRTModule>> EvalMultModKeyGen(const PrivateKey<DCRTModule> privateKey) const override;
 
-    EvalKey<DCRTModule> EvalRankRedKeyGen(const PrivateKey<DCRTModule> privateKey, PrivateKey<DCRTModule>& reducedKey, usint newRank) const override;
+    /**
+   * Relinearizes all extra components at once: they are concatenated into one module,
+   * decomposed and extended to Q_l*P together, and a single ApproxModDown pair is run
+   * after the inner products with all relinearization keys.
+   */
+    void RelinearizeInPlace(Ciphertext<DCRTModule>& ciphertext,
+                            const std::vector<EvalKey<DCRTModule>>& evalKeyVec) const override;
+
+    EvalKey<DCRTModule> EvalRankRedKeyGen(const PrivateKey<DCRTModule> privateKey, PrivateKey<DCRTModule>& reducedKey, usint newRank,
+                                          bool tagReducedKey) const override;
 
     Ciphertext<DCRTModule> EvalRankReduce(ConstCiphertext<DCRTModule> ciphertext, EvalKey<DCRTModule> reduceKey) const override;
 
+    /**
+   * Rank-reduces many ciphertexts with the same key. All removed columns are key switched
+   * together, so the key is streamed once per block of ciphertexts instead of once per ciphertext.
+   */
+    std::vector<Ciphertext<DCRTModule>> EvalRankReduceBatch(const std::vector<ConstCiphertext<DCRTModule>>& ciphertexts,
+                                                            EvalKey<DCRTModule> reduceKey) const override;
+
+    /**
+   * Generates a key that switches ciphertexts under privateKey to extendedKey of a higher rank.
+   */
+    EvalKey<DCRTModule> EvalRankExtendKeyGen(const PrivateKey<DCRTModule> privateKey,
+                                             const PrivateKey<DCRTModule> extendedKey) const override;
+
+    /**
+   * Raises the rank of a ciphertext by key switching all of its c1 columns to the extended key.
+   * The cost is one key switch at the lower rank.
+   */
+    Ciphertext<DCRTModule> EvalRankExtend(ConstCiphertext<DCRTModule> ciphertext,
+                                          EvalKey<DCRTModule> extendKey) const override;
+
+    /**
+   * Rotates a ciphertext by all indices of indexList with one set of digits. The digits are key
+   * switched with blocks of rotation keys at a time, so each digit is read once per block rather
+   * than once per index.
+   */
+    std::vector<Ciphertext<DCRTModule>> EvalFastRotationBatch(ConstCiphertext<DCRTModule> ciphertext,
+                                                              const std::vector<int32_t>& indexList, const usint m,
+                                                              const std::shared_ptr<std::vector<DCRTModule>> digits) const override;
+
+    usint FindAutomorphismIndex(usint index, usint m) const override;
+
     void AdjustLevelsAndDepthInPlace(Ciphertext<DCRTModule>& ciphertext1, Ciphertext<DCRTModule>& ciphertext2) const;
 
     void AdjustLevelsAndDepthToOneInPlace(Ciphertext<DCRTModule>& ciphertext1,
@@ -91,6 +189,9 @@ public:
 
     void LevelReduceInternalInPlace(Ciphertext<DCRTModule>& ciphertext, size_t levels) const override;
 
+    std::vector<DCRTModule::Integer> GetElementForEvalAddOrSub(ConstCiphertext<DCRTModule> ciphertext,
+                                                               double operand) const;
+
     std::vector<DCRTModule::Integer> GetElementForEvalMult(ConstCiphertext<DCRTModule> ciphertext,
                                                            double operand) const;
 
@@ -107,7 +107,14 @@ public:
     std::shared_ptr<std::vector<DCRTModule>> EncryptZeroCore(const PublicKey<DCRTModule> publicKey,
                                                              const std::shared_ptr<ParmType> params) const override;
 
+    /**
+   * Computes c0 + <c1, s> and, for a product that was not relinearized, adds the inner products
+   * of the tensored components with s (.) s and the products s_i * s_j, i < j. These powers of
+   * the secret are computed from the current private element on every call, so no
+   * secret-derived data outlives the decryption.
+   */
     DCRTModule DecryptCore(const std::vector<DCRTModule>& cv, const PrivateKey<DCRTModule> privateKey) const override;
+
     /////////////////////////////////////
     // SERIALIZATION
     /////////////////////////////////////
@@ -119,6 +119,7 @@ typename ContextGeneratorType::ContextType genCryptoContextCKKSModInternal(
     // for CKKS scheme noise scale is always set to 1
     params->SetNoiseScale(1);
     params->SetFloodingDistributionParameter(floodingNoiseStd);
+    params->SetCompressEvalKeys(parameters.GetCompressEvalKeys());
 
     uint32_t numLargeDigits =
         ComputeNumLargeDigits(parameters.GetNumLargeDigits(), parameters.GetMultiplicativeDepth());
@@ -87,6 +87,9 @@ public:
     void SetThresholdNumOfParties(uint32_t thresholdNumOfParties0) override {
         DISABLED_FOR_CKKSRNS;
     }
+    void SetCompressEvalKeys(bool compressEvalKeys0) override {
+        DISABLED_FOR_CKKSRNS;
+    }
 };
 //====================================================================================================================
 
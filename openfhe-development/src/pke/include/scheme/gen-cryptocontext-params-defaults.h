@@ -82,6 +82,7 @@ constexpr uint32_t numAdversarialQueries                    = 1;
 constexpr uint32_t thresholdNumOfParties                    = 1;
 constexpr COMPRESSION_LEVEL interactiveBootCompressionLevel = SLACK;
 constexpr uint32_t moduleRank                               = 1;
+constexpr bool compressEvalKeys                            = false;
 };  // namespace CKKSRNS_SCHEME_DEFAULTS
 
 namespace CKKSMOD_SCHEME_DEFAULTS {
@@ -123,6 +124,7 @@ constexpr uint32_t numAdversarialQueries                    = 1;
 constexpr uint32_t thresholdNumOfParties                    = 1;
 constexpr COMPRESSION_LEVEL interactiveBootCompressionLevel = SLACK;
 constexpr uint32_t moduleRank                               = 2;
+constexpr bool compressEvalKeys                            = false;
 };  // namespace CKKSRNS_SCHEME_DEFAULTS
 
 namespace BFVRNS_SCHEME_DEFAULTS {
@@ -161,6 +163,7 @@ constexpr uint32_t numAdversarialQueries                    = 0;
 constexpr uint32_t thresholdNumOfParties                    = 1;
 constexpr COMPRESSION_LEVEL interactiveBootCompressionLevel = SLACK;
 constexpr uint32_t moduleRank                               = 1;
+constexpr bool compressEvalKeys                            = false;
 };  // namespace BFVRNS_SCHEME_DEFAULTS
 
 namespace BGVRNS_SCHEME_DEFAULTS {
@@ -195,6 +198,7 @@ constexpr uint32_t numAdversarialQueries                    = 1;
 constexpr uint32_t thresholdNumOfParties                    = 1;
 constexpr COMPRESSION_LEVEL interactiveBootCompressionLevel = SLACK;
 constexpr uint32_t moduleRank                               = 1;
+constexpr bool compressEvalKeys                            = false;
 };  // namespace BGVRNS_SCHEME_DEFAULTS
 
 //====================================================================================================================
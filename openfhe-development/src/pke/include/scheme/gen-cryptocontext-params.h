@@ -169,6 +169,10 @@ class Params {
 
     uint32_t moduleRank;
 
+    // Store only a PRNG seed for the uniform part of the key switching keys when serializing them.
+    // The uniform part is regenerated from the seed on first use (supported only for CKKSMod)
+    bool compressEvalKeys;
+
     void SetToDefaults(SCHEME scheme);
 
 protected:
@@ -349,6 +353,9 @@ public:
     uint32_t GetModuleRank() const {
         return moduleRank;
     }
+    bool GetCompressEvalKeys() const {
+        return compressEvalKeys;
+    }
 
     // setters
     // They all must be virtual, so any of them can be disabled in the derived class
@@ -442,6 +449,9 @@ public:
     virtual void SetModuleRank(uint32_t moduleRank0) {
         moduleRank = moduleRank0;
     }
+    virtual void SetCompressEvalKeys(bool compressEvalKeys0) {
+        compressEvalKeys = compressEvalKeys0;
+    }
 
     friend std::ostream& operator<<(std::ostream& os, const Params& obj);
 };
@@ -38,6 +38,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 /**
  * @namespace lbcrypto
@@ -147,6 +148,14 @@ public:
         m_encodingParams = encodingParams;
     }
 
+    /**
+   * Replaces the parameters of deserialized elements by equal parameters that this object
+   * already shares with the elements it creates. Does nothing by default.
+   *
+   * @param elements the elements to update
+   */
+    virtual void InternElementParams(std::vector<Element>& elements) const {}
+
     /////////////////////////////////////
     // SERIALIZATION
     /////////////////////////////////////
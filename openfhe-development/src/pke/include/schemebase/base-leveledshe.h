@@ -514,6 +514,18 @@ public:
                                                        ConstCiphertext<Element> ciphertext2,
                                                        const std::vector<EvalKey<Element>>& evalKeyVec) const;
 
+    /**
+   * Virtual function to square a ciphertext and relinearize the result with all
+   * evaluation keys.
+   *
+   * @param ciphertext input ciphertext.
+   * @param evalKeyVec are the evaluation keys to make the result decryptable
+   * by the same secret key as that of ciphertext.
+   * @return the new resulting ciphertext.
+   */
+    virtual Ciphertext<Element> EvalSquareAndRelinearize(ConstCiphertext<Element> ciphertext,
+                                                         const std::vector<EvalKey<Element>>& evalKeyVec) const;
+
     /**
    * Virtual function to do relinearization
    *
@@ -603,6 +615,21 @@ public:
    */
     virtual std::shared_ptr<std::vector<Element>> EvalFastRotationPrecompute(ConstCiphertext<Element> ciphertext) const;
 
+    /**
+   * Virtual function for hoisted rotations of one ciphertext by many indices,
+   * all using the same digit decomposition.
+   *
+   * @param ciphertext the input ciphertext to perform the automorphisms on
+   * @param indexList the rotation indices; 0 returns a copy of the input
+   * @param m is the cyclotomic order
+   * @param digits the digit decomposition created by
+   * EvalFastRotationPrecompute at the precomputation step.
+   * @return the rotated ciphertexts, in the order of indexList
+   */
+    virtual std::vector<Ciphertext<Element>> EvalFastRotationBatch(
+        ConstCiphertext<Element> ciphertext, const std::vector<int32_t>& indexList, const usint m,
+        const std::shared_ptr<std::vector<Element>> digits) const;
+
     virtual Ciphertext<Element> EvalFastRotationExt(ConstCiphertext<Element> ciphertext, usint index,
                                                     const std::shared_ptr<std::vector<Element>> expandedCiphertext,
                                                     bool addFirst,
@@ -643,7 +670,8 @@ public:
     /////////////////////////////////////////
     // SHE LEVELED Mod Reduce
     /////////////////////////////////////////
-    virtual EvalKey<Element> EvalRankRedKeyGen(const PrivateKey<Element> privateKey, PrivateKey<Element>& reducedKey, usint newRank) const {
+    virtual EvalKey<Element> EvalRankRedKeyGen(const PrivateKey<Element> privateKey, PrivateKey<Element>& reducedKey, usint newRank,
+                                               bool tagReducedKey) const {
         OPENFHE_THROW("EvalRankRedKeyGen is not implemented for this scheme");
     }
 
@@ -651,6 +679,20 @@ public:
         OPENFHE_THROW("EvalRankReduce is not implemented for this scheme");
     }
 
+    virtual std::vector<Ciphertext<Element>> EvalRankReduceBatch(const std::vector<ConstCiphertext<Element>>& ciphertexts,
+                                                                 EvalKey<Element> reduceKey) const {
+        OPENFHE_THROW("EvalRankReduceBatch is not implemented for this scheme");
+    }
+
+    virtual EvalKey<Element> EvalRankExtendKeyGen(const PrivateKey<Element> privateKey,
+                                                  const PrivateKey<Element> extendedKey) const {
+        OPENFHE_THROW("EvalRankExtendKeyGen is not implemented for this scheme");
+    }
+
+    virtual Ciphertext<Element> EvalRankExtend(ConstCiphertext<Element> ciphertext, EvalKey<Element> extendKey) const {
+        OPENFHE_THROW("EvalRankExtend is not implemented for this scheme");
+    }
+
     /**
    * Method for Modulus Reduction.
    *
@@ -850,7 +892,7 @@ protected:
    */
     virtual Ciphertext<Element> EvalMultCore(ConstCiphertext<Element> ciphertext1, ConstCiphertext<Element> ciphertext2) const;
 
-    Ciphertext<Element> EvalSquareCore(ConstCiphertext<Element> ciphertext) const;
+    virtual Ciphertext<Element> EvalSquareCore(ConstCiphertext<Element> ciphertext) const;
 
     virtual Ciphertext<Element> EvalAddCore(ConstCiphertext<Element> ciphertext, const Element& plaintext) const;
 
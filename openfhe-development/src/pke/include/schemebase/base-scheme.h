@@ -401,6 +401,23 @@ public:
         return m_KeySwitch->EvalFastKeySwitchCore(digits, evalKey, params);
     }
 
+    virtual std::vector<std::shared_ptr<std::vector<Element>>> EvalFastKeySwitchCoreBatch(
+        const std::shared_ptr<std::vector<Element>> digits, const std::vector<EvalKey<Element>>& evalKeys,
+        const std::shared_ptr<ParmType> params) const {
+        VerifyKeySwitchEnabled(__func__);
+        if (nullptr == digits)
+            OPENFHE_THROW("Input digits is nullptr");
+        if (digits->size() == 0)
+            OPENFHE_THROW("Input digits size is 0");
+        for (const auto& evalKey : evalKeys) {
+            if (!evalKey)
+                OPENFHE_THROW("Input evaluation key is nullptr");
+        }
+        if (!params)
+            OPENFHE_THROW("Input params is nullptr");
+        return m_KeySwitch->EvalFastKeySwitchCoreBatch(digits, evalKeys, params);
+    }
+
     virtual std::shared_ptr<std::vector<Element>> KeySwitchCore(const Element& a,
                                                                 const EvalKey<Element> evalKey) const {
         VerifyKeySwitchEnabled(__func__);
@@ -409,6 +426,26 @@ public:
         return m_KeySwitch->KeySwitchCore(a, evalKey);
     }
 
+    virtual std::shared_ptr<std::vector<Element>> KeySwitchCoreMany(
+        const Element& a, const std::vector<EvalKey<Element>>& evalKeys) const {
+        VerifyKeySwitchEnabled(__func__);
+        if (evalKeys.empty())
+            OPENFHE_THROW("Input evaluation key vector is empty");
+        for (const auto& evalKey : evalKeys) {
+            if (!evalKey)
+                OPENFHE_THROW("Input evaluation key is nullptr");
+        }
+        return m_KeySwitch->KeySwitchCoreMany(a, evalKeys);
+    }
+
+    virtual std::vector<std::shared_ptr<std::vector<Element>>> KeySwitchCoreBatch(
+        const std::vector<Element>& a, const EvalKey<Element> evalKey) const {
+        VerifyKeySwitchEnabled(__func__);
+        if (!evalKey)
+            OPENFHE_THROW("Input evaluation key is nullptr");
+        return m_KeySwitch->KeySwitchCoreBatch(a, evalKey);
+    }
+
     /////////////////////////////////////////
     // PRE WRAPPER
     /////////////////////////////////////////
@@ -784,6 +821,16 @@ public:
         return m_LeveledSHE->EvalMultAndRelinearize(ciphertext1, ciphertext2, evalKeyVec);
     }
 
+    virtual Ciphertext<Element> EvalSquareAndRelinearize(ConstCiphertext<Element> ciphertext,
+                                                         const std::vector<EvalKey<Element>>& evalKeyVec) const {
+        VerifyLeveledSHEEnabled(__func__);
+        if (!ciphertext)
+            OPENFHE_THROW("Input ciphertext is nullptr");
+        if (!evalKeyVec.size())
+            OPENFHE_THROW("Input evaluation key vector is empty");
+        return m_LeveledSHE->EvalSquareAndRelinearize(ciphertext, evalKeyVec);
+    }
+
     virtual Ciphertext<Element> Relinearize(ConstCiphertext<Element> ciphertext,
                                             const std::vector<EvalKey<Element>>& evalKeyVec) const {
         VerifyLeveledSHEEnabled(__func__);
@@ -921,6 +968,17 @@ public:
         return m_LeveledSHE->EvalFastRotationPrecompute(ciphertext);
     }
 
+    virtual std::vector<Ciphertext<Element>> EvalFastRotationBatch(
+        ConstCiphertext<Element> ciphertext, const std::vector<int32_t>& indexList, const uint32_t m,
+        const std::shared_ptr<std::vector<Element>> digits) const {
+        VerifyLeveledSHEEnabled(__func__);
+        if (!ciphertext)
+            OPENFHE_THROW("Input ciphertext is nullptr");
+        if (nullptr == digits)
+            OPENFHE_THROW("Input digits is nullptr");
+        return m_LeveledSHE->EvalFastRotationBatch(ciphertext, indexList, m, digits);
+    }
+
     /**
    * Only supported for hybrid key switching.
    * Performs fast (hoisted) rotation and returns the results
@@ -985,10 +1043,19 @@ public:
     // SHE Leveled Methods Wrapper
     /////////////////////////////////////////
 
-    virtual EvalKey<Element> EvalRankRedKeyGen(const PrivateKey<Element> key, PrivateKey<Element>& reducedKey, usint newRank) const;
+    virtual EvalKey<Element> EvalRankRedKeyGen(const PrivateKey<Element> key, PrivateKey<Element>& reducedKey, usint newRank,
+                                               bool tagReducedKey = false) const;
 
     virtual Ciphertext<Element> EvalRankReduce(ConstCiphertext<Element> ciphertext, EvalKey<Element> reduceKey) const;
 
+    virtual std::vector<Ciphertext<Element>> EvalRankReduceBatch(const std::vector<ConstCiphertext<Element>>& ciphertexts,
+                                                                 EvalKey<Element> reduceKey) const;
+
+    virtual EvalKey<Element> EvalRankExtendKeyGen(const PrivateKey<Element> privateKey,
+                                                  const PrivateKey<Element> extendedKey) const;
+
+    virtual Ciphertext<Element> EvalRankExtend(ConstCiphertext<Element> ciphertext, EvalKey<Element> extendKey) const;
+
     virtual Ciphertext<Element> ComposedEvalMult(ConstCiphertext<Element> ciphertext1,
                                                  ConstCiphertext<Element> ciphertext2,
                                                  const EvalKey<Element> evalKey) const;
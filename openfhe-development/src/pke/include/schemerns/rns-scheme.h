@@ -75,6 +75,9 @@ public:
         else if (ksTech == HYBRID) {
             m_KeySwitch = std::make_shared<KeySwitchHYBRID>();
         }
+        else if (ksTech == GHS) {
+            OPENFHE_THROW("GHS key switching is supported by CKKSMOD only");
+        }
         else
             OPENFHE_THROW("ksTech is invalid");
     }
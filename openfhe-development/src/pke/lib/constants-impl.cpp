@@ -300,6 +300,8 @@ KeySwitchTechnique convertToKeySwitchTechnique(const std::string& str) {
         return BV;
     else if (str == "HYBRID")
         return HYBRID;
+    else if (str == "GHS")
+        return GHS;
 
     std::string errMsg(std::string("Unknown KeySwitchTechnique ") + str);
     OPENFHE_THROW(errMsg);
@@ -310,6 +312,7 @@ KeySwitchTechnique convertToKeySwitchTechnique(uint32_t num) {
         // case INVALID_KS_TECH:
         case BV:
         case HYBRID:
+        case GHS:
             return ksTech;
         default:
             break;
@@ -326,6 +329,9 @@ std::ostream& operator<<(std::ostream& s, KeySwitchTechnique t) {
         case HYBRID:
             s << "HYBRID";
             break;
+        case GHS:
+            s << "GHS";
+            break;
         default:
             s << "UNKNOWN";
             break;
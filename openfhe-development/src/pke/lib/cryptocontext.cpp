@@ -92,10 +92,20 @@ void CryptoContextImpl<Element>::EvalMultModKeyGen(const PrivateKey<Element> key
 }
 
 template <typename Element>
-EvalKey<Element> CryptoContextImpl<Element>::EvalRankRedKeyGen(const PrivateKey<Element> key, PrivateKey<Element>& reducedKey, usint newRank) {
+EvalKey<Element> CryptoContextImpl<Element>::EvalRankRedKeyGen(const PrivateKey<Element> key, PrivateKey<Element>& reducedKey, usint newRank,
+                                                               bool tagReducedKey) {
     ValidateKey(key);
 
-    return GetScheme()->EvalRankRedKeyGen(key, reducedKey, newRank);
+    return GetScheme()->EvalRankRedKeyGen(key, reducedKey, newRank, tagReducedKey);
+}
+
+template <typename Element>
+EvalKey<Element> CryptoContextImpl<Element>::EvalRankExtendKeyGen(const PrivateKey<Element> key,
+                                                                  const PrivateKey<Element> extendedKey) {
+    ValidateKey(key);
+    ValidateKey(extendedKey);
+
+    return GetScheme()->EvalRankExtendKeyGen(key, extendedKey);
 }
 
 template <typename Element>
@@ -32,6 +32,7 @@
 /**
  * Hybrid key switching implementation. See
  * Appendix of https://eprint.iacr.org/2021/204 for details.
+ * BV key switching shares the key layout and the inner product, with keys in basis Q.
  */
 #define PROFILE
 
@@ -42,103 +43,414 @@
 #include "key/evalkeyrelin.h"
 #include "scheme/ckksmod/ckksmod-cryptoparameters.h"
 #include "ciphertext.h"
+#include "math/distributiongenerator.h"
+#include "utils/prng/blake2engine.h"
+#include "utils/utilities-int.h"
+
+#include <algorithm>
+#include <cmath>
 
 namespace lbcrypto {
 
-EvalKey<DCRTModule> KeySwitchMod::KeySwitchGenInternal(const PrivateKey<DCRTModule> oldKey,
-                                                       const PrivateKey<DCRTModule> newKey) const {
-    return KeySwitchMod::KeySwitchGenInternal(oldKey, newKey, nullptr);
+namespace {  // this namespace should stay unnamed
+// number of ciphertexts that share one pass over the key in KeySwitchCoreBatch
+constexpr size_t KEYSWITCH_BATCH_BLOCK = 8;
+
+/**
+ * out += sum_k lhs[k] * rhs[k] for polynomials in EVALUATION format over the modulus of out.
+ * With 128-bit integers the products are accumulated lazily, see LazyBarrettSum.
+ */
+void InnerProductInPlace(NativePoly& out, const std::vector<const NativePoly*>& lhs,
+                         const std::vector<const NativePoly*>& rhs) {
+#if defined(HAVE_INT128) && NATIVEINT == 64
+    const size_t terms = lhs.size();
+    std::vector<const NativeVector*> a(terms);
+    std::vector<const NativeVector*> b(terms);
+    for (size_t k = 0; k < terms; ++k) {
+        a[k] = &lhs[k]->GetValues();
+        b[k] = &rhs[k]->GetValues();
+    }
+
+    LazyBarrettSum sum(out.GetModulus());
+    const uint32_t ringDim = out.GetRingDimension();
+    for (uint32_t ri = 0; ri < ringDim; ++ri) {
+        sum.Reset(out[ri].ConvertToInt<uint64_t>());
+        for (size_t k = 0; k < terms; ++k)
+            sum.AddProduct((*a[k])[ri].ConvertToInt<uint64_t>(), (*b[k])[ri].ConvertToInt<uint64_t>());
+        out[ri] = sum.Get();
+    }
+#else
+    for (size_t k = 0; k < lhs.size(); ++k)
+        out += lhs[k]->TimesNoCheck(*rhs[k]);
+#endif
 }
 
-EvalKey<DCRTModule> KeySwitchMod::KeySwitchGenInternal(const PrivateKey<DCRTModule> oldKey,
-                                                       const PrivateKey<DCRTModule> newKey,
-                                                       const EvalKey<DCRTModule> ekPrev) const {
-    EvalKeyRelin<DCRTModule> ek(std::make_shared<EvalKeyRelinImpl<DCRTModule>>(newKey->GetCryptoContext()));
+/**
+ * out[b] += sum_k lhs[b][k] * rhs[k] for a block of products that share the right-hand side,
+ * e.g. the digits of several ciphertexts against the same key entries, or the entries of several
+ * keys against the same digits. Every coefficient of rhs is loaded once and used for the whole block.
+ */
+void InnerProductBatchInPlace(const std::vector<NativePoly*>& out, const std::vector<std::vector<const NativePoly*>>& lhs,
+                              const std::vector<const NativePoly*>& rhs) {
+    const size_t batch = out.size();
+    const size_t terms = rhs.size();
+#if defined(HAVE_INT128) && NATIVEINT == 64
+    std::vector<const NativeVector*> b(terms);
+    for (size_t k = 0; k < terms; ++k)
+        b[k] = &rhs[k]->GetValues();
+    // a[k * batch + m] so that the inner loop walks contiguous pointers
+    std::vector<const NativeVector*> a(terms * batch);
+    for (size_t m = 0; m < batch; ++m) {
+        for (size_t k = 0; k < terms; ++k)
+            a[k * batch + m] = &lhs[m][k]->GetValues();
+    }
 
-    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(newKey->GetCryptoParameters());
+    std::vector<LazyBarrettSum> sums(batch, LazyBarrettSum(out[0]->GetModulus()));
+    const uint32_t ringDim = out[0]->GetRingDimension();
+    for (uint32_t ri = 0; ri < ringDim; ++ri) {
+        for (size_t m = 0; m < batch; ++m)
+            sums[m].Reset((*out[m])[ri].ConvertToInt<uint64_t>());
+        for (size_t k = 0; k < terms; ++k) {
+            const uint64_t r               = (*b[k])[ri].ConvertToInt<uint64_t>();
+            const NativeVector* const* row = &a[k * batch];
+            for (size_t m = 0; m < batch; ++m)
+                sums[m].AddProduct((*row[m])[ri].ConvertToInt<uint64_t>(), r);
+        }
+        for (size_t m = 0; m < batch; ++m)
+            (*out[m])[ri] = sums[m].Get();
+    }
+#else
+    for (size_t k = 0; k < terms; ++k) {
+        for (size_t m = 0; m < batch; ++m)
+            *out[m] += lhs[m][k]->TimesNoCheck(*rhs[k]);
+    }
+#endif
+}
 
-    const std::shared_ptr<ParmType> paramsQ  = cryptoParams->GetElementParams();
-    const std::shared_ptr<ParmType> paramsQP = cryptoParams->GetParamsQP();
+/**
+ * Divides a component of a key switch in Q_l*P by P, leaving it in Q_l.
+ */
+DCRTModule ModDownToQl(const DCRTModule& cTilda, const std::shared_ptr<DCRTModule::Params>& paramsQl,
+                       const CryptoParametersCKKSMod& cryptoParams) {
+    PlaintextModulus t = (cryptoParams.GetNoiseScale() == 1) ? 0 : cryptoParams.GetPlaintextModulus();
+    return cTilda.ApproxModDown(paramsQl, cryptoParams.GetParamsP(), cryptoParams.GetPInvModq(),
+                                cryptoParams.GetPInvModqPrecon(), cryptoParams.GetPHatInvModp(),
+                                cryptoParams.GetPHatInvModpPrecon(), cryptoParams.GetPHatModq(),
+                                cryptoParams.GetModqBarrettMu(), cryptoParams.GettInvModp(),
+                                cryptoParams.GettInvModpPrecon(), t, cryptoParams.GettModqPrecon());
+}
 
-    size_t sizeQ  = paramsQ->GetParams().size();
-    size_t sizeQP = paramsQP->GetParams().size();
+/**
+ * Key switches a block of inputs that share either their digits or their key: digits holds the
+ * digits in Q_l*P of each member, or of all members when it has one entry, and keys likewise. The
+ * shared side is read once for the whole block through InnerProductBatchInPlace. Returns, per
+ * member, the pair of components divided by P back to Q_l (or left in Q_l for BV).
+ */
+std::vector<std::shared_ptr<std::vector<DCRTModule>>> KeySwitchBlock(
+    const std::vector<const std::vector<DCRTModule>*>& digits, const std::vector<const EvalKeyImpl<DCRTModule>*>& keys,
+    const std::shared_ptr<DCRTModule::Params>& paramsQl, const CryptoParametersCKKSMod& cryptoParams) {
+    const size_t batch   = std::max(digits.size(), keys.size());
+    const bool sharedKey = (keys.size() == 1);
+
+    const std::shared_ptr<DCRTModule::Params> paramsQlP = (*digits[0])[0].GetParams();
+    const size_t sizeQl                                 = paramsQl->GetParams().size();
+    const size_t sizeQlP                                = paramsQlP->GetParams().size();
+    const size_t sizeQ                                  = cryptoParams.GetElementParams()->GetParams().size();
+    const size_t numDigits                              = digits[0]->size();
+    const usint cols                                    = (*digits[0])[0].GetModuleCols();
+    const usint colsOut                                 = keys[0]->GetAVector()[0].GetModuleCols();
+
+    std::vector<std::shared_ptr<std::vector<DCRTModule>>> cTilda(batch);
+    for (size_t m = 0; m < batch; ++m) {
+        cTilda[m] = std::make_shared<std::vector<DCRTModule>>(
+            std::initializer_list<DCRTModule>{DCRTModule(paramsQlP, Format::EVALUATION, true, 1),
+                                              DCRTModule(paramsQlP, Format::EVALUATION, true, 1, colsOut)});
+    }
 
-    DCRTModule sOld = oldKey->GetPrivateElement();
-    DCRTModule sNew = newKey->GetPrivateElement().Clone();
+    const size_t outputs = colsOut + 1;
+    const size_t size    = sizeQlP * outputs;
+#pragma omp parallel for num_threads(DCRTModule::GetThreadLimit(size))
+    for (size_t n = 0; n < size; ++n) {
+        const usint i = n / outputs;
+        const usint o = n % outputs;
+        // the towers of P follow the full basis Q in the keys; BV digits have no towers of P
+        const usint idx = (i < sizeQl) ? i : i - sizeQl + sizeQ;
+
+        // the digit or key entries of member m that multiply each other, in the same order
+        auto entries = [&](size_t m, bool key) {
+            std::vector<const NativePoly*> v;
+            v.reserve(numDigits * cols);
+            for (uint32_t j = 0; j < numDigits; j++) {
+                for (usint k = 0; k < cols; k++) {
+                    if (!key)
+                        v.push_back(&(*digits[m])[j].GetElementAtIndex(0, k, i));
+                    else if (o == 0)
+                        v.push_back(&keys[m]->GetBVector()[j].GetElementAtIndex(k, 0, idx));
+                    else
+                        v.push_back(&keys[m]->GetAVector()[j].GetElementAtIndex(k, o - 1, idx));
+                }
+            }
+            return v;
+        };
+
+        const std::vector<const NativePoly*> rhs = entries(0, sharedKey);
+        std::vector<NativePoly*> out(batch);
+        std::vector<std::vector<const NativePoly*>> lhs(batch);
+        for (size_t m = 0; m < batch; ++m) {
+            lhs[m]                      = entries(m, !sharedKey);
+            std::vector<DCRTModule>& ct = *cTilda[m];
+            out[m] = (o == 0) ? &ct[0].GetElementAtIndex(0, 0, i) : &ct[1].GetElementAtIndex(0, o - 1, i);
+        }
+        InnerProductBatchInPlace(out, lhs, rhs);
+    }
 
-    // skNew is currently in basis Q. This extends it to basis QP.
-    sNew.SetFormat(Format::COEFFICIENT);
+    // BV has no special modulus to divide by
+    if (cryptoParams.GetKeySwitchTechnique() == BV)
+        return cTilda;
 
-    DCRTModule sNewExt(paramsQP, Format::COEFFICIENT, true, sNew.GetModuleRows());
+    // ApproxModDown is parallel over the towers and entries of each component
+    for (size_t m = 0; m < batch; ++m) {
+        DCRTModule ct0 = ModDownToQl((*cTilda[m])[0], paramsQl, cryptoParams);
+        DCRTModule ct1 = ModDownToQl((*cTilda[m])[1], paramsQl, cryptoParams);
+        cTilda[m] =
+            std::make_shared<std::vector<DCRTModule>>(std::initializer_list<DCRTModule>{std::move(ct0), std::move(ct1)});
+    }
+    return cTilda;
+}
 
-    // The part with basis Q
-    for (size_t row = 0; row < sNew.GetModuleRows(); row++) {
-        for (size_t i = 0; i < sizeQ; i++) {
-            sNewExt.SetElementAtIndex(row, 0, i, sNew.GetElementAtIndex(row, 0, i));
+/**
+ * Draws a fresh BLAKE2 seed from the library PRNG.
+ */
+std::vector<uint32_t> GenerateSeed() {
+    std::vector<uint32_t> seed(default_prng::Blake2Engine::MAX_SEED_GENS);
+    for (auto& word : seed)
+        word = PseudoRandomNumberGenerator::GetPRNG()();
+    return seed;
+}
+
+/**
+ * Samples the errors of a key switching key with numDigits digits of rows entries each from a
+ * secret BLAKE2 seed. The error of digit d, row r is drawn by dgg from a BLAKE2 engine with its own
+ * counter range, so the errors are sampled in parallel and do not depend on the number of threads.
+ */
+std::vector<DCRTModule> SampleErrorVector(const std::vector<uint32_t>& seed, size_t numDigits,
+                                          const std::shared_ptr<DCRTModule::Params>& params, usint rows,
+                                          const DCRTModule::DggType& dgg) {
+    default_prng::Blake2Engine::blake2_seed_array_t key{};
+    std::copy(seed.begin(), seed.end(), key.begin());
+
+    const uint32_t ringDim = params->GetRingDimension();
+    const auto& towers     = params->GetParams();
+
+    std::vector<DCRTModule> ev;
+    ev.reserve(numDigits);
+    for (size_t d = 0; d < numDigits; ++d)
+        ev.emplace_back(params, Format::EVALUATION, false, rows);
+
+    const size_t size = numDigits * rows;
+#pragma omp parallel for num_threads(DCRTModule::GetThreadLimit(size))
+    for (size_t n = 0; n < size; ++n) {
+        const size_t d   = n / rows;
+        const size_t row = n % rows;
+        default_prng::Blake2Engine prng(key, (static_cast<uint64_t>(d) << 40) | (static_cast<uint64_t>(row) << 20));
+        const std::shared_ptr<int64_t> e = dgg.GenerateIntVector(ringDim, prng);
+
+        DCRTModule::DCRTPolyType poly(params, Format::COEFFICIENT, true);
+        for (size_t i = 0; i < towers.size(); ++i) {
+            const NativeInteger& modulus = towers[i]->GetModulus();
+            NativeVector values(ringDim, modulus);
+            for (uint32_t j = 0; j < ringDim; ++j) {
+                const int64_t v = (e.get())[j];
+                values[j]       = (v < 0) ? modulus - NativeInteger(static_cast<uint64_t>(-v)) :
+                                            NativeInteger(static_cast<uint64_t>(v));
+            }
+            NativePoly tower(towers[i], Format::COEFFICIENT);
+            tower.SetValues(std::move(values), Format::COEFFICIENT);
+            poly.SetElementAtIndex(i, std::move(tower));
         }
+        poly.SetFormat(Format::EVALUATION);
+        ev[d].SetDCRTPolyAt(row, std::move(poly));
     }
+    return ev;
+}
 
-    // The part with basis P
-    for (size_t row = 0; row < sNew.GetModuleRows(); row++) {
-        for (size_t j = sizeQ; j < sizeQP; j++) {
-            const NativeInteger& pj    = paramsQP->GetParams()[j]->GetModulus();
-            const NativeInteger& rootj = paramsQP->GetParams()[j]->GetRootOfUnity();
-            auto sNew0                 = sNew.GetElementAtIndex(row, 0, 0);
-            sNew0.SwitchModulus(pj, rootj, 0, 0);
-            sNewExt.SetElementAtIndex(row, 0, j, std::move(sNew0));
+/**
+ * Gadget of hybrid key switching: digit d multiplies sOld by P on the towers of the d-th
+ * partition of Q and by zero elsewhere.
+ */
+std::vector<std::vector<NativeInteger>> GadgetHybrid(const CryptoParametersCKKSMod& cryptoParams) {
+    const std::vector<NativeInteger>& PModq = cryptoParams.GetPModq();
+    const size_t sizeQ                      = cryptoParams.GetElementParams()->GetParams().size();
+    const size_t numPartQ                   = cryptoParams.GetNumPartQ();
+    const size_t numPerPartQ                = cryptoParams.GetNumPerPartQ();
+
+    std::vector<std::vector<NativeInteger>> gadget(numPartQ, std::vector<NativeInteger>(sizeQ, NativeInteger(0)));
+    for (size_t part = 0; part < numPartQ; ++part) {
+        // starting and ending position of current part
+        size_t startPartIdx = numPerPartQ * part;
+        size_t endPartIdx   = std::min(startPartIdx + numPerPartQ, sizeQ);
+        for (size_t i = startPartIdx; i < endPartIdx; ++i)
+            gadget[part][i] = PModq[i];
+    }
+    return gadget;
+}
+
+/**
+ * Gadget of BV key switching, in the order of the digits of DCRTModule::CRTDecompose: each tower
+ * q_i is one digit with residue 1 at q_i, or, for digitSize > 0, is split into windows w with
+ * residue 2^(w * digitSize) at q_i. All other residues are zero.
+ */
+std::vector<std::vector<NativeInteger>> GadgetBV(const std::shared_ptr<DCRTModule::Params>& paramsQ,
+                                                 uint32_t digitSize) {
+    const size_t sizeQ = paramsQ->GetParams().size();
+
+    std::vector<std::vector<NativeInteger>> gadget;
+    for (size_t i = 0; i < sizeQ; ++i) {
+        const NativeInteger& qi = paramsQ->GetParams()[i]->GetModulus();
+        uint32_t nWindows       = 1;
+        if (digitSize > 0) {
+            uint32_t nBits = qi.GetLengthForBase(2);
+            nWindows       = nBits / digitSize + ((nBits % digitSize > 0) ? 1 : 0);
+        }
+        for (uint32_t w = 0; w < nWindows; ++w) {
+            std::vector<NativeInteger> digit(sizeQ, NativeInteger(0));
+            digit[i] = NativeInteger(2).ModExp(NativeInteger(w * digitSize), qi);
+            gadget.push_back(std::move(digit));
         }
     }
+    return gadget;
+}
+}  // namespace
 
-    sNewExt.SetFormat(Format::EVALUATION);
+EvalKey<DCRTModule> KeySwitchMod::KeySwitchGenInternal(const PrivateKey<DCRTModule> oldKey,
+                                                       const PrivateKey<DCRTModule> newKey) const {
+    return KeySwitchMod::KeySwitchGenInternal(oldKey, newKey, nullptr);
+}
 
-    const auto ns      = cryptoParams->GetNoiseScale();
-    const DggType& dgg = cryptoParams->GetDiscreteGaussianGenerator();
-    DugType dug;
+EvalKey<DCRTModule> KeySwitchMod::KeySwitchGenInternal(const PrivateKey<DCRTModule> oldKey,
+                                                       const PrivateKey<DCRTModule> newKey,
+                                                       const EvalKey<DCRTModule> ekPrev) const {
+    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(newKey->GetCryptoParameters());
+
+    // seed-compressed keys sample A from a recorded seed, the others from the uniform generator
+    std::vector<uint32_t> aSeed;
+    if (ekPrev == nullptr && cryptoParams->GetCompressEvalKeys())
+        aSeed = GenerateSeed();
+    // the errors come from a fresh secret seed that is not stored with the key
+    return KeySwitchGenFromSeeds(oldKey, newKey, ekPrev, aSeed, GenerateSeed());
+}
+
+EvalKey<DCRTModule> KeySwitchMod::KeySwitchGenSeeded(const PrivateKey<DCRTModule> oldKey,
+                                                     const PrivateKey<DCRTModule> newKey,
+                                                     const std::vector<uint32_t>& aSeed,
+                                                     const std::vector<uint32_t>& errorSeed) const {
+    for (const auto* seed : {&aSeed, &errorSeed}) {
+        if (seed->empty() || seed->size() > default_prng::Blake2Engine::MAX_SEED_GENS)
+            OPENFHE_THROW("KeySwitchGenSeeded: a seed must have between 1 and " +
+                          std::to_string(default_prng::Blake2Engine::MAX_SEED_GENS) + " words");
+    }
+    return KeySwitchGenFromSeeds(oldKey, newKey, nullptr, aSeed, errorSeed);
+}
 
-    size_t numPartQ = cryptoParams->GetNumPartQ();
+EvalKey<DCRTModule> KeySwitchMod::KeySwitchGenFromSeeds(const PrivateKey<DCRTModule> oldKey,
+                                                        const PrivateKey<DCRTModule> newKey,
+                                                        const EvalKey<DCRTModule> ekPrev,
+                                                        const std::vector<uint32_t>& aSeed,
+                                                        const std::vector<uint32_t>& errorSeed) const {
+    EvalKeyRelin<DCRTModule> ek(std::make_shared<EvalKeyRelinImpl<DCRTModule>>(newKey->GetCryptoContext()));
 
-    std::vector<DCRTModule> Av(numPartQ);
-    std::vector<DCRTModule> bv(numPartQ);
+    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(newKey->GetCryptoParameters());
 
-    std::vector<NativeInteger> PModq = cryptoParams->GetPModq();
-    size_t numPerPartQ               = cryptoParams->GetNumPerPartQ();
+    // hybrid (and GHS) keys live in basis QP, BV keys in basis Q
+    const bool isBV = (cryptoParams->GetKeySwitchTechnique() == BV);
 
-    for (size_t part = 0; part < numPartQ; ++part) {
-        DCRTModule A = (ekPrev == nullptr) ? DCRTModule(dug, paramsQP, Format::EVALUATION, sOld.GetModuleRows(),
-                                                        sNew.GetModuleRows()) :  // single-key HE
-                                             ekPrev->GetAVector()[part];                           // threshold HE
-        DCRTModule e(dgg, paramsQP, Format::EVALUATION, sOld.GetModuleRows());
-        DCRTModule b(paramsQP, Format::EVALUATION, true, sOld.GetModuleRows());
+    const std::shared_ptr<ParmType> paramsQ   = cryptoParams->GetElementParams();
+    const std::shared_ptr<ParmType> paramsKey = isBV ? paramsQ : cryptoParams->GetParamsQP();
 
-        // starting and ending position of current part
-        size_t startPartIdx = numPerPartQ * part;
-        size_t endPartIdx   = (sizeQ > (startPartIdx + numPerPartQ)) ? (startPartIdx + numPerPartQ) : sizeQ;
+    size_t sizeQ   = paramsQ->GetParams().size();
+    size_t sizeKey = paramsKey->GetParams().size();
 
-        for (size_t row = 0; row < sOld.GetModuleRows(); row++) {
-            for (size_t i = 0; i < sizeQP; ++i) {
-                auto Aji_sNew = A.GetElementAtIndex(row, 0, i) * sNewExt.GetElementAtIndex(0, 0, i);
-                for (size_t j = 1; j < sNewExt.GetModuleRows(); j++) {
-                    Aji_sNew += A.GetElementAtIndex(row, j, i) * sNewExt.GetElementAtIndex(j, 0, i);
-                }
-                auto ei = e.GetElementAtIndex(row, 0, i);
+    const DCRTModule& sOld = oldKey->GetPrivateElement();
 
-                if (i < startPartIdx || i >= endPartIdx) {
-                    b.SetElementAtIndex(row, 0, i, -Aji_sNew + ns * ei);
-                }
-                else {
-                    // P * sOld is only applied for the current part
-                    auto sOldi = sOld.GetElementAtIndex(row, 0, i);
-                    b.SetElementAtIndex(row, 0, i, -Aji_sNew + PModq[i] * sOldi + ns * ei);
-                }
+    const usint rowsOld = sOld.GetModuleRows();
+    const usint rowsNew = newKey->GetPrivateElement().GetModuleRows();
+
+    DCRTModule sNewExt;
+    if (!isBV) {
+        // skNew is currently in basis Q. This extends it to basis QP.
+        DCRTModule sNew = newKey->GetPrivateElement().Clone();
+        sNew.SetFormat(Format::COEFFICIENT);
+
+        sNewExt = DCRTModule(paramsKey, Format::COEFFICIENT, true, rowsNew);
+
+        // The part with basis Q is copied, the part with basis P is switched from the first tower
+        const size_t size = rowsNew * sizeKey;
+#pragma omp parallel for num_threads(DCRTModule::GetThreadLimit(size))
+        for (size_t n = 0; n < size; ++n) {
+            const usint row = n / sizeKey;
+            const usint j   = n % sizeKey;
+            if (j < sizeQ) {
+                sNewExt.SetElementAtIndex(row, 0, j, sNew.GetElementAtIndex(row, 0, j));
+            }
+            else {
+                const NativeInteger& pj    = paramsKey->GetParams()[j]->GetModulus();
+                const NativeInteger& rootj = paramsKey->GetParams()[j]->GetRootOfUnity();
+                auto sNew0                 = sNew.GetElementAtIndex(row, 0, 0);
+                sNew0.SwitchModulus(pj, rootj, 0, 0);
+                sNewExt.SetElementAtIndex(row, 0, j, std::move(sNew0));
             }
         }
 
-        Av[part] = A;
-        bv[part] = b;
+        sNewExt.SetFormat(Format::EVALUATION);
+    }
+    const DCRTModule& sNewKey = isBV ? newKey->GetPrivateElement() : sNewExt;
+
+    const auto ns      = cryptoParams->GetNoiseScale();
+    const DggType& dgg = cryptoParams->GetDiscreteGaussianGenerator();
+
+    // digit d of the key encrypts gadget[d] * sOld, see GadgetBV and GadgetHybrid
+    const std::vector<std::vector<NativeInteger>> gadget =
+        isBV ? GadgetBV(paramsQ, cryptoParams->GetDigitSize()) : GadgetHybrid(*cryptoParams);
+    const size_t numDigits = gadget.size();
+
+    // Threshold keys share A and its seed. With a seed, A is expanded from it, otherwise it comes
+    // from the uniform generator.
+    std::vector<uint32_t> seed;
+    std::vector<DCRTModule> Av;
+    if (ekPrev != nullptr) {
+        auto ekPrevRelin = std::dynamic_pointer_cast<EvalKeyRelinImpl<DCRTModule>>(ekPrev);
+        if (ekPrevRelin != nullptr)
+            seed = ekPrevRelin->GetAVectorSeed();
+        Av = ekPrev->GetAVector();
+    }
+    else if (!aSeed.empty()) {
+        seed = aSeed;
+        Av   = DCRTModule::SampleUniform(seed, numDigits, paramsKey, rowsOld, rowsNew);
+    }
+    else {
+        DugType dug;
+        Av.reserve(numDigits);
+        for (size_t d = 0; d < numDigits; ++d)
+            Av.emplace_back(dug, paramsKey, Format::EVALUATION, rowsOld, rowsNew);
+    }
+
+    // the error seed is secret and is not stored with the key
+    std::vector<DCRTModule> bv = SampleErrorVector(errorSeed, numDigits, paramsKey, rowsOld, dgg);
+
+    // the products below are parallel over rows and towers
+    for (size_t d = 0; d < numDigits; ++d) {
+        // b = ns * e - A * sNew + gadget * sOld
+        DCRTModule& b = bv[d];
+        if (ns != 1)
+            b *= DCRTModule::Integer(ns);
+        b.MultiplySubtractInPlace(Av[d], sNewKey);
+        b.ScaleAndAddInPlace(sOld, gadget[d]);
     }
 
     ek->SetAVector(std::move(Av));
     ek->SetBVector(std::move(bv));
+    if (!seed.empty())
+        ek->SetAVectorSeed(seed, rowsNew);
     ek->SetKeyTag(newKey->GetKeyTag());
     return ek;
 }
@@ -168,13 +480,78 @@ std::shared_ptr<std::vector<DCRTModule>> KeySwitchMod::KeySwitchCore(const DCRTM
                                  a.GetParams());
 }
 
+std::shared_ptr<std::vector<DCRTModule>> KeySwitchMod::KeySwitchCoreMany(
+    const DCRTModule& a, const std::vector<EvalKey<DCRTModule>>& evalKeys) const {
+    if (evalKeys.size() == 1)
+        return KeySwitchCore(a, evalKeys[0]);
+
+    size_t cols = 0;
+    for (const auto& evalKey : evalKeys)
+        cols += evalKey->GetBVector()[0].GetModuleRows();
+    if (cols != a.GetModuleCols())
+        OPENFHE_THROW("The evaluation keys do not cover the columns of the input module");
+
+    return EvalFastKeySwitchCore(EvalKeySwitchPrecomputeCore(a, evalKeys[0]->GetCryptoParameters()), evalKeys,
+                                 a.GetParams());
+}
+
+std::vector<std::shared_ptr<std::vector<DCRTModule>>> KeySwitchMod::KeySwitchCoreBatch(
+    const std::vector<DCRTModule>& a, const EvalKey<DCRTModule> evalKey) const {
+    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(evalKey->GetCryptoParameters());
+
+    const usint cols = evalKey->GetBVector()[0].GetModuleRows();
+    for (const auto& m : a) {
+        if (m.GetModuleCols() != cols)
+            OPENFHE_THROW("The evaluation key does not match the columns of an input module");
+    }
+
+    const size_t count = a.size();
+    // the decomposition of each module is parallel over its own entries and towers
+    std::vector<std::shared_ptr<std::vector<DCRTModule>>> digits(count);
+    for (size_t m = 0; m < count; ++m)
+        digits[m] = EvalKeySwitchPrecomputeCore(a[m], cryptoParams);
+
+    // The inputs are taken in blocks of consecutive modules at the same level. Within a block
+    // every key entry is read once for all members, so the key, which is much larger than one
+    // ciphertext, streams through the cache count / KEYSWITCH_BATCH_BLOCK times instead of count times.
+    std::vector<std::shared_ptr<std::vector<DCRTModule>>> result(count);
+    for (size_t first = 0; first < count;) {
+        const size_t sizeQl = a[first].GetParams()->GetParams().size();
+
+        size_t last = first + 1;
+        while (last < count && last - first < KEYSWITCH_BATCH_BLOCK &&
+               a[last].GetParams()->GetParams().size() == sizeQl)
+            ++last;
+
+        std::vector<const std::vector<DCRTModule>*> block;
+        for (size_t m = first; m < last; ++m)
+            block.push_back(digits[m].get());
+        auto switched = KeySwitchBlock(block, {evalKey.get()}, a[first].GetParams(), *cryptoParams);
+        for (size_t m = first; m < last; ++m) {
+            result[m] = std::move(switched[m - first]);
+            digits[m].reset();
+        }
+        first = last;
+    }
+    return result;
+}
+
 std::shared_ptr<std::vector<DCRTModule>> KeySwitchMod::EvalKeySwitchPrecomputeCore(
     const DCRTModule& c, std::shared_ptr<CryptoParametersBase<DCRTModule>> cryptoParamsBase) const {
     const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(cryptoParamsBase);
 
-    const std::shared_ptr<ParmType> paramsQl  = c.GetParams();
-    const std::shared_ptr<ParmType> paramsP   = cryptoParams->GetParamsP();
-    const std::shared_ptr<ParmType> paramsQlP = c.GetExtendedCRTBasis(paramsP);
+    // BV digits stay in basis Q_l
+    if (cryptoParams->GetKeySwitchTechnique() == BV)
+        return std::make_shared<std::vector<DCRTModule>>(c.CRTDecompose(cryptoParams->GetDigitSize()));
+
+    const std::shared_ptr<ParmType> paramsQl = c.GetParams();
+    const std::shared_ptr<ParmType> paramsP  = cryptoParams->GetParamsP();
+    // inputs on the modulus chain use the precomputed params of their level
+    std::shared_ptr<ParmType> paramsQlP =
+        cryptoParams->HasParamsQl(paramsQl) ? cryptoParams->GetParamsQlP(paramsQl->GetParams().size()) : nullptr;
+    const bool cached = (paramsQlP != nullptr);
+    if (!cached)
+        paramsQlP = c.GetExtendedCRTBasis(paramsP);
 
     size_t sizeQl  = paramsQl->GetParams().size();
     size_t sizeP   = paramsP->GetParams().size();
@@ -186,12 +563,19 @@ std::shared_ptr<std::vector<DCRTModule>> KeySwitchMod::EvalKeySwitchPrecomputeCo
     if (numPartQl > cryptoParams->GetNumberOfQPartitions())
         numPartQl = cryptoParams->GetNumberOfQPartitions();
 
-    std::vector<DCRTModule> partsCt(numPartQl);
+    // With a single digit (GHS, or a hybrid ciphertext at a low level) the digit is the input
+    // itself, so the split into partial digits is skipped
+    const bool singleDigit = (numPartQl == 1);
+    std::vector<DCRTModule> partsCt(singleDigit ? 0 : numPartQl);
 
     // Digit decomposition
     // Zero-padding and split
-    for (uint32_t part = 0; part < numPartQl; part++) {
-        if (part == numPartQl - 1) {
+    for (uint32_t part = 0; part < numPartQl && !singleDigit; part++) {
+        if (part == numPartQl - 1 && cached) {
+            partsCt[part] = DCRTModule(cryptoParams->GetParamsLastPartQl(sizeQl), Format::EVALUATION, false, 1,
+                                       c.GetModuleCols());
+        }
+        else if (part == numPartQl - 1) {
             auto paramsPartQ = cryptoParams->GetParamsPartQ(part);
 
             uint32_t sizePartQl = sizeQl - alpha * part;
@@ -207,11 +591,11 @@ std::shared_ptr<std::vector<DCRTModule>> KeySwitchMod::EvalKeySwitchPrecomputeCo
             auto params = DCRTModule::Params(paramsPartQ->GetCyclotomicOrder(), moduli, roots);
 
             partsCt[part] =
-                DCRTModule(std::make_shared<ParmType>(params), Format::EVALUATION, true, 1, c.GetModuleCols());
+                DCRTModule(std::make_shared<ParmType>(params), Format::EVALUATION, false, 1, c.GetModuleCols());
         }
         else {
             partsCt[part] =
-                DCRTModule(cryptoParams->GetParamsPartQ(part), Format::EVALUATION, true, 1, c.GetModuleCols());
+                DCRTModule(cryptoParams->GetParamsPartQ(part), Format::EVALUATION, false, 1, c.GetModuleCols());
         }
 
         usint sizePartQl   = partsCt[part].GetNumOfElements();
@@ -227,10 +611,12 @@ std::shared_ptr<std::vector<DCRTModule>> KeySwitchMod::EvalKeySwitchPrecomputeCo
     std::vector<DCRTModule> partsCtExt(numPartQl);
 
     for (uint32_t part = 0; part < numPartQl; part++) {
-        auto partCtClone = partsCt[part].Clone();
+        const DCRTModule& partCt = singleDigit ? c : partsCt[part];
+
+        auto partCtClone = partCt.Clone();
         partCtClone.SetFormat(Format::COEFFICIENT);
 
-        uint32_t sizePartQl = partsCt[part].GetNumOfElements();
+        uint32_t sizePartQl = partCt.GetNumOfElements();
         partsCtCompl[part]  = partCtClone.ApproxSwitchCRTBasis(
             cryptoParams->GetParamsPartQ(part), cryptoParams->GetParamsComplPartQ(sizeQl - 1, part),
             cryptoParams->GetPartQlHatInvModq(part, sizePartQl - 1),
@@ -240,7 +626,8 @@ std::shared_ptr<std::vector<DCRTModule>> KeySwitchMod::EvalKeySwitchPrecomputeCo
 
         partsCtCompl[part].SetFormat(Format::EVALUATION);
 
-        partsCtExt[part] = DCRTModule(paramsQlP, Format::EVALUATION, true, 1, c.GetModuleCols());
+        // every tower is assigned below, so the towers are not zero-initialized
+        partsCtExt[part] = DCRTModule(paramsQlP, Format::EVALUATION, false, 1, c.GetModuleCols());
 
         for (size_t col = 0; col < c.GetModuleCols(); col++) {
             usint startPartIdx = alpha * part;
@@ -249,7 +636,7 @@ std::shared_ptr<std::vector<DCRTModule>> KeySwitchMod::EvalKeySwitchPrecomputeCo
                 partsCtExt[part].SetElementAtIndex(0, col, i, partsCtCompl[part].GetElementAtIndex(0, col, i));
             }
             for (usint i = startPartIdx, idx = 0; i < endPartIdx; i++, idx++) {
-                partsCtExt[part].SetElementAtIndex(0, col, i, partsCt[part].GetElementAtIndex(0, col, idx));
+                partsCtExt[part].SetElementAtIndex(0, col, i, partCt.GetElementAtIndex(0, col, idx));
             }
             for (usint i = endPartIdx; i < sizeQlP; ++i) {
                 partsCtExt[part].SetElementAtIndex(0, col, i,
@@ -264,81 +651,110 @@ std::shared_ptr<std::vector<DCRTModule>> KeySwitchMod::EvalKeySwitchPrecomputeCo
 std::shared_ptr<std::vector<DCRTModule>> KeySwitchMod::EvalFastKeySwitchCore(
     const std::shared_ptr<std::vector<DCRTModule>> digits, const EvalKey<DCRTModule> evalKey,
     const std::shared_ptr<ParmType> paramsQl) const {
-    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(evalKey->GetCryptoParameters());
+    return EvalFastKeySwitchCore(digits, std::vector<EvalKey<DCRTModule>>{evalKey}, paramsQl);
+}
 
-    std::shared_ptr<std::vector<DCRTModule>> cTilda = EvalFastKeySwitchCoreExt(digits, evalKey, paramsQl);
+std::shared_ptr<std::vector<DCRTModule>> KeySwitchMod::EvalFastKeySwitchCore(
+    const std::shared_ptr<std::vector<DCRTModule>> digits, const std::vector<EvalKey<DCRTModule>>& evalKeys,
+    const std::shared_ptr<ParmType> paramsQl) const {
+    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(evalKeys[0]->GetCryptoParameters());
 
-    PlaintextModulus t = (cryptoParams->GetNoiseScale() == 1) ? 0 : cryptoParams->GetPlaintextModulus();
+    std::shared_ptr<std::vector<DCRTModule>> cTilda = EvalFastKeySwitchCoreExt(digits, evalKeys, paramsQl);
 
-    DCRTModule ct0 = (*cTilda)[0].ApproxModDown(paramsQl, cryptoParams->GetParamsP(), cryptoParams->GetPInvModq(),
-                                                cryptoParams->GetPInvModqPrecon(), cryptoParams->GetPHatInvModp(),
-                                                cryptoParams->GetPHatInvModpPrecon(), cryptoParams->GetPHatModq(),
-                                                cryptoParams->GetModqBarrettMu(), cryptoParams->GettInvModp(),
-                                                cryptoParams->GettInvModpPrecon(), t, cryptoParams->GettModqPrecon());
+    // BV has no special modulus to divide by
+    if (cryptoParams->GetKeySwitchTechnique() == BV)
+        return cTilda;
 
-    DCRTModule ct1 = (*cTilda)[1].ApproxModDown(paramsQl, cryptoParams->GetParamsP(), cryptoParams->GetPInvModq(),
-                                                cryptoParams->GetPInvModqPrecon(), cryptoParams->GetPHatInvModp(),
-                                                cryptoParams->GetPHatInvModpPrecon(), cryptoParams->GetPHatModq(),
-                                                cryptoParams->GetModqBarrettMu(), cryptoParams->GettInvModp(),
-                                                cryptoParams->GettInvModpPrecon(), t, cryptoParams->GettModqPrecon());
+    DCRTModule ct0 = ModDownToQl((*cTilda)[0], paramsQl, *cryptoParams);
+    DCRTModule ct1 = ModDownToQl((*cTilda)[1], paramsQl, *cryptoParams);
 
     return std::make_shared<std::vector<DCRTModule>>(std::initializer_list<DCRTModule>{std::move(ct0), std::move(ct1)});
 }
 
+std::vector<std::shared_ptr<std::vector<DCRTModule>>> KeySwitchMod::EvalFastKeySwitchCoreBatch(
+    const std::shared_ptr<std::vector<DCRTModule>> digits, const std::vector<EvalKey<DCRTModule>>& evalKeys,
+    const std::shared_ptr<ParmType> paramsQl) const {
+    const size_t count = evalKeys.size();
+    std::vector<std::shared_ptr<std::vector<DCRTModule>>> result(count);
+    if (count == 0)
+        return result;
+
+    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(evalKeys[0]->GetCryptoParameters());
+
+    const usint cols    = (*digits)[0].GetModuleCols();
+    const usint colsOut = evalKeys[0]->GetAVector()[0].GetModuleCols();
+    for (const auto& evalKey : evalKeys) {
+        if (evalKey->GetBVector()[0].GetModuleRows() != cols || evalKey->GetAVector()[0].GetModuleCols() != colsOut)
+            OPENFHE_THROW("The evaluation keys do not match the columns of the digits");
+    }
+
+    // The keys are taken in blocks; within a block the digit entries are shared by all members
+    for (size_t first = 0; first < count; first += KEYSWITCH_BATCH_BLOCK) {
+        const size_t last = std::min(first + KEYSWITCH_BATCH_BLOCK, count);
+
+        std::vector<const EvalKeyImpl<DCRTModule>*> block;
+        for (size_t m = first; m < last; ++m)
+            block.push_back(evalKeys[m].get());
+        auto switched = KeySwitchBlock({digits.get()}, block, paramsQl, *cryptoParams);
+        for (size_t m = first; m < last; ++m)
+            result[m] = std::move(switched[m - first]);
+    }
+    return result;
+}
+
 std::shared_ptr<std::vector<DCRTModule>> KeySwitchMod::EvalFastKeySwitchCoreExt(
     const std::shared_ptr<std::vector<DCRTModule>> digits, const EvalKey<DCRTModule> evalKey,
     const std::shared_ptr<ParmType> paramsQl) const {
-    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(evalKey->GetCryptoParameters());
-    const std::vector<DCRTModule>& bv = evalKey->GetBVector();
-    const std::vector<DCRTModule>& Av = evalKey->GetAVector();
+    return EvalFastKeySwitchCoreExt(digits, std::vector<EvalKey<DCRTModule>>{evalKey}, paramsQl);
+}
+
+std::shared_ptr<std::vector<DCRTModule>> KeySwitchMod::EvalFastKeySwitchCoreExt(
+    const std::shared_ptr<std::vector<DCRTModule>> digits, const std::vector<EvalKey<DCRTModule>>& evalKeys,
+    const std::shared_ptr<ParmType> paramsQl) const {
+    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(evalKeys[0]->GetCryptoParameters());
 
-    const std::shared_ptr<ParmType> paramsP   = cryptoParams->GetParamsP();
     const std::shared_ptr<ParmType> paramsQlP = (*digits)[0].GetParams();
 
     size_t sizeQl  = paramsQl->GetParams().size();
     size_t sizeQlP = paramsQlP->GetParams().size();
     size_t sizeQ   = cryptoParams->GetElementParams()->GetParams().size();
 
-    DCRTModule cTilda0(paramsQlP, Format::EVALUATION, true, 1);
-    DCRTModule cTilda1(paramsQlP, Format::EVALUATION, true, 1, Av[0].GetModuleCols());
-
-    for (uint32_t j = 0; j < digits->size(); j++) {
-        const DCRTModule& cj = (*digits)[j];
-        const DCRTModule& bj = bv[j];
-        const DCRTModule& Aj = Av[j];
-
-        for (size_t col = 0; col < cj.GetModuleCols(); col++) {
-            for (usint i = 0; i < sizeQl; i++) {
-                const auto& cji = cj.GetElementAtIndex(0, col, i);
-                const auto& bji = bj.GetElementAtIndex(col, 0, i);
-
-                cTilda0.SetElementAtIndex(0, 0, i, cTilda0.GetElementAtIndex(0, 0, i) + cji * bji);
-            }
-            for (usint i = sizeQl, idx = sizeQ; i < sizeQlP; i++, idx++) {
-                const auto& cji = cj.GetElementAtIndex(0, col, i);
-                const auto& bji = bj.GetElementAtIndex(col, 0, idx);
+    const usint colsOut = evalKeys[0]->GetAVector()[0].GetModuleCols();
 
-                cTilda0.SetElementAtIndex(0, 0, i, cTilda0.GetElementAtIndex(0, 0, i) + cji * bji);
-            }
-        }
-        for (size_t col = 0; col < cTilda1.GetModuleCols(); col++) {
-            for (usint i = 0; i < sizeQl; i++) {
-                auto cji_Aji = cj.GetElementAtIndex(0, 0, i) * Aj.GetElementAtIndex(0, col, i);
-                for (size_t k = 1; k < cj.GetModuleCols(); k++) {
-                    cji_Aji += cj.GetElementAtIndex(0, k, i) * Aj.GetElementAtIndex(k, col, i);
-                }
-
-                cTilda1.SetElementAtIndex(0, col, i, cTilda1.GetElementAtIndex(0, col, i) + cji_Aji);
-            }
-            for (usint i = sizeQl, idx = sizeQ; i < sizeQlP; i++, idx++) {
-                auto cji_Aji = cj.GetElementAtIndex(0, 0, i) * Aj.GetElementAtIndex(0, col, idx);
-                for (size_t k = 1; k < cj.GetModuleCols(); k++) {
-                    cji_Aji += cj.GetElementAtIndex(0, k, i) * Aj.GetElementAtIndex(k, col, idx);
+    DCRTModule cTilda0(paramsQlP, Format::EVALUATION, true, 1);
+    DCRTModule cTilda1(paramsQlP, Format::EVALUATION, true, 1, colsOut);
+
+    // Every (tower, output column) pair is an independent sum of products of digit columns with
+    // key entries, so the pairs are spread over the threads and each sum is written in place.
+    // Each key covers the next bv[0].GetModuleRows() columns of the digits.
+    const size_t outputs = colsOut + 1;
+    const size_t size    = sizeQlP * outputs;
+#pragma omp parallel for num_threads(DCRTModule::GetThreadLimit(size))
+    for (size_t n = 0; n < size; ++n) {
+        const usint i = n / outputs;
+        const usint o = n % outputs;
+        // the towers of P follow the full basis Q in the keys; BV digits have no towers of P
+        const usint idx = (i < sizeQl) ? i : i - sizeQl + sizeQ;
+
+        std::vector<const NativePoly*> lhs;
+        std::vector<const NativePoly*> rhs;
+        size_t offset = 0;
+        for (const auto& evalKey : evalKeys) {
+            const std::vector<DCRTModule>& bv = evalKey->GetBVector();
+            const std::vector<DCRTModule>& Av = evalKey->GetAVector();
+            const usint cols                  = bv[0].GetModuleRows();
+            for (uint32_t j = 0; j < digits->size(); j++) {
+                for (usint k = 0; k < cols; k++) {
+                    lhs.push_back(&(*digits)[j].GetElementAtIndex(0, offset + k, i));
+                    rhs.push_back((o == 0) ? &bv[j].GetElementAtIndex(k, 0, idx) :
+                                             &Av[j].GetElementAtIndex(k, o - 1, idx));
                 }
-
-                cTilda1.SetElementAtIndex(0, col, i, cTilda1.GetElementAtIndex(0, col, i) + cji_Aji);
             }
+            offset += cols;
         }
+
+        NativePoly& out = (o == 0) ? cTilda0.GetElementAtIndex(0, 0, i) : cTilda1.GetElementAtIndex(0, o - 1, i);
+        InnerProductInPlace(out, lhs, rhs);
     }
 
     return std::make_shared<std::vector<DCRTModule>>(
@@ -0,0 +1,268 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+
+#include "scheme/ckksmod/ckksmod-convert.h"
+
+#include "cryptocontextfactory.h"
+
+#include "scheme/ckksmod/ckksmod-cryptoparameters.h"
+#include "scheme/ckksrns/ckksrns-cryptoparameters.h"
+#include "scheme/ckksrns/ckksrns-scheme.h"
+#include "scheme/scheme-utils.h"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace lbcrypto {
+
+namespace {  // this namespace should stay unnamed
+/**
+ * Checks that the towers of an element are a prefix of the modulus chain of the target context.
+ */
+void CheckSameModuli(const std::shared_ptr<ILDCRTParams<BigInteger>>& params,
+                     const std::shared_ptr<ILDCRTParams<BigInteger>>& target) {
+    const auto& towers       = params->GetParams();
+    const auto& targetTowers = target->GetParams();
+    if (params->GetRingDimension() != target->GetRingDimension() || towers.size() > targetTowers.size())
+        OPENFHE_THROW("The crypto contexts are not built from the same moduli");
+    for (size_t i = 0; i < towers.size(); ++i) {
+        if (towers[i]->GetModulus() != targetTowers[i]->GetModulus())
+            OPENFHE_THROW("The crypto contexts are not built from the same moduli");
+    }
+}
+
+/**
+ * Returns the secret key s in the basis target. The towers both bases share must have the same
+ * moduli. Towers of s beyond target are dropped; towers of target beyond s, e.g. the moduli P of
+ * a hybrid context for a BV key in Q, are switched from the first tower, which holds the small
+ * secret exactly.
+ */
+DCRTPoly SecretInBasis(const DCRTPoly& s, const std::shared_ptr<ILDCRTParams<BigInteger>>& target) {
+    const auto& towers       = s.GetParams()->GetParams();
+    const auto& targetTowers = target->GetParams();
+    const size_t common      = std::min(towers.size(), targetTowers.size());
+    if (s.GetRingDimension() != target->GetRingDimension())
+        OPENFHE_THROW("The crypto contexts are not built from the same moduli");
+    for (size_t i = 0; i < common; ++i) {
+        if (towers[i]->GetModulus() != targetTowers[i]->GetModulus())
+            OPENFHE_THROW("The crypto contexts are not built from the same moduli");
+    }
+    if (towers.size() == targetTowers.size())
+        return s;
+
+    DCRTPoly sCoef = s;
+    sCoef.SetFormat(Format::COEFFICIENT);
+    DCRTPoly result(target, Format::COEFFICIENT, true);
+    for (size_t i = 0; i < targetTowers.size(); ++i) {
+        if (i < common) {
+            result.SetElementAtIndex(i, sCoef.GetElementAtIndex(i));
+        }
+        else {
+            auto tower = sCoef.GetElementAtIndex(0);
+            tower.SwitchModulus(targetTowers[i]->GetModulus(), targetTowers[i]->GetRootOfUnity(), 0, 0);
+            result.SetElementAtIndex(i, std::move(tower));
+        }
+    }
+    result.SetFormat(Format::EVALUATION);
+    return result;
+}
+
+template <typename ElementFrom, typename ElementTo>
+void CopyCiphertextMetadata(const CiphertextImpl<ElementFrom>& from, CiphertextImpl<ElementTo>& to) {
+    to.SetKeyTag(from.GetKeyTag());
+    to.SetEncodingType(from.GetEncodingType());
+    to.SetNoiseScaleDeg(from.GetNoiseScaleDeg());
+    to.SetLevel(from.GetLevel());
+    to.SetHopLevel(from.GetHopLevel());
+    to.SetScalingFactor(from.GetScalingFactor());
+    to.SetScalingFactorInt(from.GetScalingFactorInt());
+    to.SetSlots(from.GetSlots());
+    to.SetMetadataMap(from.GetMetadataMap());
+}
+}  // namespace
+
+CryptoContext<DCRTPoly> GenCompatibleCryptoContextCKKSRNS(const CryptoContext<DCRTModule>& ccMod) {
+    const auto paramsMod = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(ccMod->GetCryptoParameters());
+    if (paramsMod == nullptr)
+        OPENFHE_THROW("The crypto context is not a CKKSMod context");
+
+    // the element parameters are shared, so the towers of converted ciphertexts keep their params
+    const auto elementParams = paramsMod->GetElementParams();
+    const size_t sizeQ       = elementParams->GetParams().size();
+
+    // clang-format off
+    auto paramsRNS = std::make_shared<CryptoParametersCKKSRNS>(
+        elementParams,
+        paramsMod->GetEncodingParams(),
+        paramsMod->GetDistributionParameter(),
+        paramsMod->GetAssuranceMeasure(),
+        paramsMod->GetStdLevel(),
+        paramsMod->GetDigitSize(),
+        paramsMod->GetSecretKeyDist(),
+        paramsMod->GetMaxRelinSkDeg(),
+        HYBRID,
+        paramsMod->GetScalingTechnique(),
+        paramsMod->GetEncryptionTechnique(),
+        paramsMod->GetMultiplicationTechnique(),
+        paramsMod->GetPREMode(),
+        paramsMod->GetMultipartyMode(),
+        paramsMod->GetExecutionMode(),
+        paramsMod->GetDecryptionNoiseMode(),
+        paramsMod->GetNoiseScale(),
+        paramsMod->GetStatisticalSecurity(),
+        paramsMod->GetNumAdversarialQueries(),
+        paramsMod->GetThresholdNumOfParties(),
+        paramsMod->GetMPIntBootCiphertextCompressionLevel()
+    );
+    // clang-format on
+    paramsRNS->SetFloodingDistributionParameter(paramsMod->GetFloodingDistributionParameter());
+
+    // BV contexts have no digits of Q; pick the default number of digits for the chain
+    uint32_t numPartQ = (paramsMod->GetKeySwitchTechnique() == BV || paramsMod->GetNumPartQ() == 0) ?
+                            ComputeNumLargeDigits(0, sizeQ - 1) :
+                            paramsMod->GetNumPartQ();
+    paramsRNS->PrecomputeCRTTables(HYBRID, paramsMod->GetScalingTechnique(), paramsMod->GetEncryptionTechnique(),
+                                   paramsMod->GetMultiplicationTechnique(), numPartQ, paramsMod->GetAuxBits(),
+                                   paramsMod->GetExtraBits());
+
+    // ciphertexts and keys in QP only carry over if both contexts extend Q by the same P
+    if (paramsMod->GetKeySwitchTechnique() != BV) {
+        const auto& towersP    = paramsMod->GetParamsP()->GetParams();
+        const auto& towersPRNS = paramsRNS->GetParamsP()->GetParams();
+        if (towersP.size() != towersPRNS.size())
+            OPENFHE_THROW("The CKKSRNS context does not reproduce the moduli P of the CKKSMod context");
+        for (size_t i = 0; i < towersP.size(); ++i) {
+            if (towersP[i]->GetModulus() != towersPRNS[i]->GetModulus())
+                OPENFHE_THROW("The CKKSRNS context does not reproduce the moduli P of the CKKSMod context");
+        }
+    }
+
+    auto scheme = std::make_shared<SchemeCKKSRNS>();
+    scheme->SetKeySwitchingTechnique(HYBRID);
+
+    auto cc = CryptoContextFactory<DCRTPoly>::GetContext(paramsRNS, scheme);
+    cc->setSchemeId(SCHEME::CKKSRNS_SCHEME);
+    return cc;
+}
+
+Ciphertext<DCRTPoly> ConvertCKKSModToCKKSRNS(Ciphertext<DCRTModule>&& input, const CryptoContext<DCRTPoly>& ccRNS) {
+    // the towers are only moved out of a ciphertext nobody else holds
+    Ciphertext<DCRTModule> ciphertext = std::move(input);
+    if (ciphertext.use_count() > 1)
+        ciphertext = ciphertext->Clone();
+
+    std::vector<DCRTModule>& cv = ciphertext->GetElements();
+    if (cv.size() != 2)
+        OPENFHE_THROW("Only ciphertexts with two elements can be converted");
+    if (cv[0].GetModuleRows() != 1 || cv[0].GetModuleCols() != 1 || cv[1].GetModuleRows() != 1 ||
+        cv[1].GetModuleCols() != 1)
+        OPENFHE_THROW("Only rank-1 ciphertexts can be converted; reduce the rank with EvalRankReduce first");
+    CheckSameModuli(cv[0].GetParams(), ccRNS->GetElementParams());
+
+    auto result = std::make_shared<CiphertextImpl<DCRTPoly>>(ccRNS);
+    CopyCiphertextMetadata(*ciphertext, *result);
+
+    std::vector<DCRTPoly> elements;
+    elements.reserve(2);
+    for (auto& c : cv) {
+        elements.push_back(c.ReleaseDCRTPolyAt(0));
+        elements.back().SetFormat(Format::EVALUATION);
+    }
+    cv.clear();
+
+    result->SetElements(std::move(elements));
+    return result;
+}
+
+Ciphertext<DCRTPoly> ConvertCKKSModToCKKSRNS(ConstCiphertext<DCRTModule> ciphertext,
+                                             const CryptoContext<DCRTPoly>& ccRNS) {
+    return ConvertCKKSModToCKKSRNS(ciphertext->Clone(), ccRNS);
+}
+
+Ciphertext<DCRTModule> ConvertCKKSRNSToCKKSMod(Ciphertext<DCRTPoly>&& input,
+                                               const CryptoContext<DCRTModule>& ccMod) {
+    // the towers are only moved out of a ciphertext nobody else holds
+    Ciphertext<DCRTPoly> ciphertext = std::move(input);
+    if (ciphertext.use_count() > 1)
+        ciphertext = ciphertext->Clone();
+
+    std::vector<DCRTPoly>& cv = ciphertext->GetElements();
+    if (cv.size() != 2)
+        OPENFHE_THROW("Only ciphertexts with two elements can be converted");
+    CheckSameModuli(cv[0].GetParams(), ccMod->GetElementParams());
+
+    auto result = std::make_shared<CiphertextImpl<DCRTModule>>(ccMod);
+    CopyCiphertextMetadata(*ciphertext, *result);
+
+    std::vector<DCRTModule> elements;
+    elements.reserve(2);
+    for (auto& c : cv) {
+        elements.emplace_back(std::move(c));
+        elements.back().SetFormat(Format::EVALUATION);
+    }
+    cv.clear();
+
+    result->SetElements(std::move(elements));
+    return result;
+}
+
+Ciphertext<DCRTModule> ConvertCKKSRNSToCKKSMod(ConstCiphertext<DCRTPoly> ciphertext,
+                                               const CryptoContext<DCRTModule>& ccMod) {
+    return ConvertCKKSRNSToCKKSMod(ciphertext->Clone(), ccMod);
+}
+
+PrivateKey<DCRTPoly> ConvertCKKSModToCKKSRNS(const PrivateKey<DCRTModule>& privateKey,
+                                             const CryptoContext<DCRTPoly>& ccRNS) {
+    const DCRTModule& s = privateKey->GetPrivateElement();
+    if (s.GetModuleRows() != 1 || s.GetModuleCols() != 1)
+        OPENFHE_THROW("Only rank-1 secret keys can be converted; generate one with EvalRankRedKeyGen");
+    // secret keys are sampled in the basis of the public key, which includes P for hybrid key switching;
+    // keys of BV contexts are extended to the basis QP of the CKKSRNS context
+    auto result = std::make_shared<PrivateKeyImpl<DCRTPoly>>(ccRNS);
+    result->SetKeyTag(privateKey->GetKeyTag());
+    result->SetPrivateElement(SecretInBasis(s.GetDCRTPolyAt(0), ccRNS->GetCryptoParameters()->GetParamsPK()));
+    return result;
+}
+
+PrivateKey<DCRTModule> ConvertCKKSRNSToCKKSMod(const PrivateKey<DCRTPoly>& privateKey,
+                                               const CryptoContext<DCRTModule>& ccMod) {
+    // keys of BV contexts drop the moduli P of the CKKSRNS context
+    auto result = std::make_shared<PrivateKeyImpl<DCRTModule>>(ccMod);
+    result->SetKeyTag(privateKey->GetKeyTag());
+    result->SetPrivateElement(
+        DCRTModule(SecretInBasis(privateKey->GetPrivateElement(), ccMod->GetCryptoParameters()->GetParamsPK())));
+    return result;
+}
+
+}  // namespace lbcrypto
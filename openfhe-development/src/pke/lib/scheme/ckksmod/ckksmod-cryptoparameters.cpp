@@ -57,6 +57,15 @@ void CryptoParametersCKKSMod::PrecomputeCRTTables(KeySwitchTechnique ksTech, Sca
         rootsQ[i]  = GetElementParams()->GetParams()[i]->GetRootOfUnity();
     }
 
+    // Pre-compute the shared parameters of every level; the full level uses the element params
+    m_paramsQl.resize(sizeQ);
+    m_paramsQl[sizeQ - 1] = GetElementParams();
+    for (size_t l = sizeQ - 1; l > 0; --l) {
+        auto paramsQl = std::make_shared<ParmType>(*m_paramsQl[l]);
+        paramsQl->PopLastParam();
+        m_paramsQl[l - 1] = std::move(paramsQl);
+    }
+
     BigInteger modulusQ = GetElementParams()->GetModulus();
     // Pre-compute values for rescaling
     // modulusQ holds Q^(l) = \prod_{i=0}^{i=l}(q_i).
@@ -140,12 +149,92 @@ void CryptoParametersCKKSMod::PrecomputeCRTTables(KeySwitchTechnique ksTech, Sca
         const auto p = GetPlaintextModulus();
         m_approxSF   = pow(2, p);
     }
-    if (m_ksTechnique == HYBRID) {
+
+    // Pre-compute the residues of the scaling factor of each level, by which EvalAdd and EvalSub with
+    // a real number raise the constant to the depth of the ciphertext. The factor may exceed 64 bits,
+    // so the rounded double is converted exactly from its mantissa and exponent.
+    m_scalingFactorIntCRT.resize(sizeQ);
+    for (size_t l = 0; l < sizeQ; ++l) {
+        const double scFactor = GetScalingFactorReal(l);
+        int32_t exponent      = 0;
+        const double mantissa = std::frexp(std::round(scFactor), &exponent);
+        BigInteger intScFactor(static_cast<uint64_t>(std::ldexp(mantissa, 53)));
+        if (exponent >= 53)
+            intScFactor.LShiftEq(exponent - 53);
+        else
+            intScFactor.RShiftEq(53 - exponent);
+
+        m_scalingFactorIntCRT[l].resize(sizeQ);
+        for (size_t i = 0; i < sizeQ; ++i)
+            m_scalingFactorIntCRT[l][i] = intScFactor.Mod(BigInteger(moduliQ[i])).ConvertToInt<BasicInteger>();
+    }
+    if (m_ksTechnique == HYBRID || m_ksTechnique == GHS) {
         const auto BarrettBase128Bit(BigInteger(1).LShiftEq(128));
         m_modqBarrettMu.resize(sizeQ);
         for (uint32_t i = 0; i < sizeQ; i++) {
             m_modqBarrettMu[i] = (BarrettBase128Bit / BigInteger(moduliQ[i])).ConvertToInt<DoubleNativeInt>();
         }
+
+        // Pre-compute the extended basis Q_l * P and the params of the last, possibly partial, digit
+        // of every level, so that key switching does not build params objects
+        const auto& paramsP = GetParamsP()->GetParams();
+        const uint32_t alpha = GetNumPerPartQ();
+        m_paramsQlP.resize(sizeQ);
+        m_paramsLastPartQl.resize(sizeQ);
+        for (size_t l = 0; l < sizeQ; ++l) {
+            const size_t sizeQl = l + 1;
+
+            std::vector<NativeInteger> moduliQlP(sizeQl + paramsP.size());
+            std::vector<NativeInteger> rootsQlP(sizeQl + paramsP.size());
+            for (size_t i = 0; i < sizeQl; ++i) {
+                moduliQlP[i] = moduliQ[i];
+                rootsQlP[i]  = rootsQ[i];
+            }
+            for (size_t i = 0; i < paramsP.size(); ++i) {
+                moduliQlP[sizeQl + i] = paramsP[i]->GetModulus();
+                rootsQlP[sizeQl + i]  = paramsP[i]->GetRootOfUnity();
+            }
+            m_paramsQlP[l] = std::make_shared<ParmType>(2 * GetElementParams()->GetRingDimension(), moduliQlP, rootsQlP);
+
+            const uint32_t part       = std::min<uint32_t>(l / alpha, GetNumberOfQPartitions() - 1);
+            const auto& paramsPartQ   = GetParamsPartQ(part);
+            const uint32_t sizePartQl = sizeQl - alpha * part;
+            if (sizePartQl == paramsPartQ->GetParams().size()) {
+                m_paramsLastPartQl[l] = paramsPartQ;
+            }
+            else {
+                std::vector<NativeInteger> moduli(sizePartQl);
+                std::vector<NativeInteger> roots(sizePartQl);
+                for (uint32_t i = 0; i < sizePartQl; ++i) {
+                    moduli[i] = paramsPartQ->GetParams()[i]->GetModulus();
+                    roots[i]  = paramsPartQ->GetParams()[i]->GetRootOfUnity();
+                }
+                m_paramsLastPartQl[l] = std::make_shared<ParmType>(paramsPartQ->GetCyclotomicOrder(), moduli, roots);
+            }
+        }
+    }
+}
+
+std::shared_ptr<CryptoParametersCKKSMod::ParmType> CryptoParametersCKKSMod::InternParamsQl(
+    const std::shared_ptr<ParmType>& params) const {
+    const auto& towers  = params->GetParams();
+    const auto paramsQl = GetParamsQl(towers.size());
+    if (paramsQl == nullptr || paramsQl == params || paramsQl->GetRingDimension() != params->GetRingDimension())
+        return params;
+
+    const auto& towersQl = paramsQl->GetParams();
+    for (size_t i = 0; i < towers.size(); ++i) {
+        if (towersQl[i]->GetModulus() != towers[i]->GetModulus())
+            return params;
+    }
+    return paramsQl;
+}
+
+void CryptoParametersCKKSMod::InternElementParams(std::vector<DCRTModule>& elements) const {
+    for (auto& element : elements) {
+        const auto paramsQl = InternParamsQl(element.GetParams());
+        if (paramsQl != element.GetParams())
+            element.DropLastElements(0, paramsQl);
     }
 }
 
@@ -44,6 +44,72 @@ CKKS implementation. See https://eprint.iacr.org/2020/1118 for details.
 
 namespace lbcrypto {
 
+namespace {  // this namespace should stay unnamed
+/**
+ * Tag of the rank-reduced secret derived from the secret with the given tag, used when
+ * EvalRankRedKeyGen is asked to tag the reduced key. Reduced keys and reduced ciphertexts then
+ * get the same tag, so the context finds the relinearization keys of the reduced secret for the
+ * reduced ciphertexts.
+ */
+std::string RankReducedKeyTag(const std::string& keyTag, usint newRank) {
+    return keyTag + "-rank" + std::to_string(newRank);
+}
+
+/**
+ * Tag of a ciphertext reduced to newRank with reduceKey, which carries the tag of the reduced key:
+ * the derived tag if the reduced key was tagged, and the tag of the input otherwise.
+ */
+std::string ReducedCiphertextKeyTag(const std::string& keyTag, usint newRank, const EvalKey<DCRTModule>& reduceKey) {
+    std::string reducedTag = RankReducedKeyTag(keyTag, newRank);
+    return (reduceKey->GetKeyTag() == reducedTag) ? reducedTag : keyTag;
+}
+
+/**
+ * Whether the adjustments before an addition (forMult == false) or a multiplication leave the
+ * plaintext as it is, apart from dropping towers. This mirrors AdjustForAddOrSubInPlace and
+ * AdjustForMultInPlace: the plaintext is rescaled or multiplied by a constant only when it is
+ * below the ciphertext level or its depth has to be raised.
+ */
+bool IsPlaintextUsableInPlace(ConstCiphertext<DCRTModule> ciphertext, ConstPlaintext plaintext, bool forMult) {
+    if (plaintext->GetElement<DCRTPoly>().GetFormat() != Format::EVALUATION)
+        return false;
+
+    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(ciphertext->GetCryptoParameters());
+    const usint ctLevel     = ciphertext->GetLevel();
+    const usint ptLevel     = plaintext->GetLevel();
+    const usint ctDepth     = ciphertext->GetNoiseScaleDeg();
+    const usint ptDepth     = plaintext->GetNoiseScaleDeg();
+
+    switch (cryptoParams->GetScalingTechnique()) {
+        case NORESCALE:
+            return true;
+        case FIXEDMANUAL:
+            return forMult || ptDepth >= ctDepth;
+        default:
+            if (forMult)
+                return ptDepth == 1 && (ptLevel > ctLevel || (ptLevel == ctLevel && ctDepth == 1));
+            return ptLevel > ctLevel || (ptLevel == ctLevel && ptDepth >= ctDepth);
+    }
+}
+
+/**
+ * Ciphertext with the metadata and the towers of the plaintext but without coefficients. It stands
+ * in for the plaintext in the level and depth adjustments when IsPlaintextUsableInPlace holds.
+ */
+Ciphertext<DCRTModule> PlaintextProxy(ConstPlaintext plaintext, ConstCiphertext<DCRTModule> ciphertext) {
+    auto result = ciphertext->CloneEmpty();
+
+    result->SetNoiseScaleDeg(plaintext->GetNoiseScaleDeg());
+    result->SetLevel(plaintext->GetLevel());
+    result->SetScalingFactor(plaintext->GetScalingFactor());
+    result->SetScalingFactorInt(plaintext->GetScalingFactorInt());
+    result->SetSlots(plaintext->GetSlots());
+    result->SetElements({DCRTModule(plaintext->GetElement<DCRTPoly>().GetParams(), Format::EVALUATION, false)});
+
+    return result;
+}
+}  // namespace
+
 void LeveledSHECKKSMod::EvalAddInPlace(Ciphertext<DCRTModule>& ciphertext1,
                                        ConstCiphertext<DCRTModule> ciphertext2) const {
     const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(ciphertext1->GetCryptoParameters());
@@ -74,6 +140,96 @@ void LeveledSHECKKSMod::EvalSubInPlace(Ciphertext<DCRTModule>& ciphertext1,
     }
 }
 
+void LeveledSHECKKSMod::EvalAddInPlace(Ciphertext<DCRTModule>& ciphertext, ConstPlaintext plaintext) const {
+    if (IsPlaintextUsableInPlace(ciphertext, plaintext, false)) {
+        auto ptProxy = PlaintextProxy(plaintext, ciphertext);
+        AdjustForAddOrSubInPlace(ciphertext, ptProxy);
+        ciphertext->GetElements()[0].AddPolyInPlace(plaintext->GetElement<DCRTPoly>());
+    }
+    else {
+        auto ctmorphed = MorphPlaintext(plaintext, ciphertext);
+        AdjustForAddOrSubInPlace(ciphertext, ctmorphed);
+        EvalAddCoreInPlace(ciphertext, ctmorphed->GetElements()[0]);
+    }
+}
+
+void LeveledSHECKKSMod::EvalSubInPlace(Ciphertext<DCRTModule>& ciphertext, ConstPlaintext plaintext) const {
+    if (IsPlaintextUsableInPlace(ciphertext, plaintext, false)) {
+        auto ptProxy = PlaintextProxy(plaintext, ciphertext);
+        AdjustForAddOrSubInPlace(ciphertext, ptProxy);
+        ciphertext->GetElements()[0].SubtractPolyInPlace(plaintext->GetElement<DCRTPoly>());
+    }
+    else {
+        auto ctmorphed = MorphPlaintext(plaintext, ciphertext);
+        AdjustForAddOrSubInPlace(ciphertext, ctmorphed);
+        EvalSubCoreInPlace(ciphertext, ctmorphed->GetElements()[0]);
+    }
+}
+
+Ciphertext<DCRTModule> LeveledSHECKKSMod::EvalAdd(ConstCiphertext<DCRTModule> ciphertext, double operand) const {
+    Ciphertext<DCRTModule> result = ciphertext->Clone();
+    EvalAddInPlace(result, operand);
+    return result;
+}
+
+void LeveledSHECKKSMod::EvalAddInPlace(Ciphertext<DCRTModule>& ciphertext, double operand) const {
+    ciphertext->GetElements()[0].AddConstantInPlace(GetElementForEvalAddOrSub(ciphertext, operand));
+}
+
+Ciphertext<DCRTModule> LeveledSHECKKSMod::EvalSub(ConstCiphertext<DCRTModule> ciphertext, double operand) const {
+    Ciphertext<DCRTModule> result = ciphertext->Clone();
+    EvalSubInPlace(result, operand);
+    return result;
+}
+
+void LeveledSHECKKSMod::EvalSubInPlace(Ciphertext<DCRTModule>& ciphertext, double operand) const {
+    ciphertext->GetElements()[0].SubtractConstantInPlace(GetElementForEvalAddOrSub(ciphertext, operand));
+}
+
+Ciphertext<DCRTModule> LeveledSHECKKSMod::EvalMult(ConstCiphertext<DCRTModule> ciphertext, double operand) const {
+    Ciphertext<DCRTModule> result = ciphertext->Clone();
+    EvalMultInPlace(result, operand);
+    return result;
+}
+
+void LeveledSHECKKSMod::EvalMultInPlace(Ciphertext<DCRTModule>& ciphertext, double operand) const {
+    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(ciphertext->GetCryptoParameters());
+
+    if (cryptoParams->GetScalingTechnique() != FIXEDMANUAL) {
+        if (ciphertext->GetNoiseScaleDeg() == 2) {
+            ModReduceInternalInPlace(ciphertext, BASE_NUM_LEVELS_TO_DROP);
+        }
+    }
+
+    EvalMultCoreInPlace(ciphertext, operand);
+}
+
+void LeveledSHECKKSMod::EvalMultInPlace(Ciphertext<DCRTModule>& ciphertext, ConstPlaintext plaintext) const {
+    Ciphertext<DCRTModule> ctmorphed;
+    if (IsPlaintextUsableInPlace(ciphertext, plaintext, true)) {
+        ctmorphed = PlaintextProxy(plaintext, ciphertext);
+        AdjustForMultInPlace(ciphertext, ctmorphed);
+        for (auto& c : ciphertext->GetElements())
+            c.MultiplyByPolyInPlace(plaintext->GetElement<DCRTPoly>());
+    }
+    else {
+        ctmorphed = MorphPlaintext(plaintext, ciphertext);
+        AdjustForMultInPlace(ciphertext, ctmorphed);
+        const DCRTPoly pt = ctmorphed->GetElements()[0].ReleaseDCRTPolyAt(0);
+        for (auto& c : ciphertext->GetElements())
+            c.MultiplyByPolyInPlace(pt);
+    }
+
+    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(ciphertext->GetCryptoParameters());
+    ciphertext->SetNoiseScaleDeg(ciphertext->GetNoiseScaleDeg() + ctmorphed->GetNoiseScaleDeg());
+    ciphertext->SetScalingFactor(ciphertext->GetScalingFactor() * ctmorphed->GetScalingFactor());
+    if (cryptoParams->GetScalingTechnique() == FLEXIBLEAUTO || cryptoParams->GetScalingTechnique() == FLEXIBLEAUTOEXT) {
+        const auto plainMod = cryptoParams->GetPlaintextModulus();
+        ciphertext->SetScalingFactorInt(
+            ciphertext->GetScalingFactorInt().ModMul(ctmorphed->GetScalingFactorInt(), plainMod));
+    }
+}
+
 Ciphertext<DCRTModule> LeveledSHECKKSMod::EvalMult(ConstCiphertext<DCRTModule> ciphertext1,
                                                    ConstCiphertext<DCRTModule> ciphertext2) const {
     const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(ciphertext1->GetCryptoParameters());
@@ -94,24 +250,26 @@ Ciphertext<DCRTModule> LeveledSHECKKSMod::EvalMultCore(ConstCiphertext<DCRTModul
     VerifyNumOfTowers(ciphertext1, ciphertext2);
     Ciphertext<DCRTModule> result = ciphertext1->CloneZero();
 
-    std::vector<DCRTModule> cv1        = ciphertext1->GetElements();
+    const std::vector<DCRTModule>& cv1 = ciphertext1->GetElements();
     const std::vector<DCRTModule>& cv2 = ciphertext2->GetElements();
 
     if (cv1.size() != 2 || cv2.size() != 2) {
         OPENFHE_THROW("EvalMultCore: only possible for ciphertexts of size 2.");
     }
 
-    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(ciphertext1->GetCryptoParameters());
-
-    std::vector<DCRTModule> cvMult(3);
-
-    cvMult[0] = cv1[0] * cv2[0];
-    cvMult[1] = cv1[1] * cv2[0] + cv1[0] * cv2[1];
-    cvMult[2] = cv1[1].HadamardProduct(cv2[1]);
-    if (cryptoParams->GetModuleRank() > 1) {
-        cvMult.push_back(cv1[1].LowerTriangleProduct(cv2[1]) + cv2[1].LowerTriangleProduct(cv1[1]));
+    // the rank is taken from the operands: rank-reduced ciphertexts live in the same context
+    const usint rank = cv1[1].GetModuleCols();
+    if (cv2[1].GetModuleCols() != rank) {
+        OPENFHE_THROW("EvalMultCore: the ciphertexts have different ranks; use EvalRankExtend first");
     }
 
+    // all products of (c0, c1) and (c0', c1') in one parallel pass; each symmetric cross term
+    // c1_i * c2_j + c1_j * c2_i and each linear term shares a single modular reduction
+    std::vector<DCRTModule> cvMult(4);
+    cv1[1].TensorProduct(cv1[0], cv2[1], cv2[0], cvMult[0], cvMult[1], cvMult[2], cvMult[3]);
+    if (rank == 1)
+        cvMult.resize(3);
+
     result->SetElements(std::move(cvMult));
     result->SetNoiseScaleDeg(ciphertext1->GetNoiseScaleDeg() + ciphertext2->GetNoiseScaleDeg());
     result->SetScalingFactor(ciphertext1->GetScalingFactor() * ciphertext2->GetScalingFactor());
@@ -121,14 +279,62 @@ Ciphertext<DCRTModule> LeveledSHECKKSMod::EvalMultCore(ConstCiphertext<DCRTModul
     return result;
 }
 
+Ciphertext<DCRTModule> LeveledSHECKKSMod::EvalSquare(ConstCiphertext<DCRTModule> ciphertext) const {
+    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(ciphertext->GetCryptoParameters());
+
+    if (cryptoParams->GetScalingTechnique() == NORESCALE || cryptoParams->GetScalingTechnique() == FIXEDMANUAL ||
+        ciphertext->GetNoiseScaleDeg() == 1) {
+        return EvalSquareCore(ciphertext);
+    }
+
+    auto c = ciphertext->Clone();
+    ModReduceInternalInPlace(c, BASE_NUM_LEVELS_TO_DROP);
+
+    return EvalSquareCore(c);
+}
+
+Ciphertext<DCRTModule> LeveledSHECKKSMod::EvalSquareMutable(Ciphertext<DCRTModule>& ciphertext) const {
+    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(ciphertext->GetCryptoParameters());
+
+    if (cryptoParams->GetScalingTechnique() != NORESCALE && cryptoParams->GetScalingTechnique() != FIXEDMANUAL &&
+        ciphertext->GetNoiseScaleDeg() == 2) {
+        ModReduceInternalInPlace(ciphertext, BASE_NUM_LEVELS_TO_DROP);
+    }
+
+    return EvalSquareCore(ciphertext);
+}
+
+Ciphertext<DCRTModule> LeveledSHECKKSMod::EvalSquareCore(ConstCiphertext<DCRTModule> ciphertext) const {
+    Ciphertext<DCRTModule> result = ciphertext->CloneZero();
+
+    const std::vector<DCRTModule>& cv = ciphertext->GetElements();
+
+    if (cv.size() != 2) {
+        OPENFHE_THROW("EvalSquareCore: only possible for ciphertexts of size 2.");
+    }
+
+    const usint rank = cv[1].GetModuleCols();
+
+    // c0^2, 2 * c0 * c1_i, c1_i^2 and 2 * c1_i * c1_j in one parallel pass, each product computed once
+    std::vector<DCRTModule> cvSquare(4);
+    cv[1].TensorProduct(cv[0], cv[1], cv[0], cvSquare[0], cvSquare[1], cvSquare[2], cvSquare[3]);
+    if (rank == 1)
+        cvSquare.resize(3);
+
+    result->SetElements(std::move(cvSquare));
+    result->SetNoiseScaleDeg(2 * ciphertext->GetNoiseScaleDeg());
+    result->SetScalingFactor(ciphertext->GetScalingFactor() * ciphertext->GetScalingFactor());
+    const auto plainMod = ciphertext->GetCryptoParameters()->GetPlaintextModulus();
+    result->SetScalingFactorInt(ciphertext->GetScalingFactorInt().ModMul(ciphertext->GetScalingFactorInt(), plainMod));
+    return result;
+}
+
 void LeveledSHECKKSMod::EvalMultCoreInPlace(Ciphertext<DCRTModule>& ciphertext, double operand) const {
     const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(ciphertext->GetCryptoParameters());
 
     std::vector<DCRTModule::Integer> factors = GetElementForEvalMult(ciphertext, operand);
-    std::vector<DCRTModule>& cv              = ciphertext->GetElements();
-    for (usint i = 0; i < cv.size(); ++i) {
-        cv[i] = cv[i] * factors;
-    }
+    for (auto& c : ciphertext->GetElements())
+        c.MultiplyConstantInPlace(factors);
     ciphertext->SetNoiseScaleDeg(ciphertext->GetNoiseScaleDeg() + 1);
 
     double scFactor = cryptoParams->GetScalingFactorReal(ciphertext->GetLevel());
@@ -136,33 +342,73 @@ void LeveledSHECKKSMod::EvalMultCoreInPlace(Ciphertext<DCRTModule>& ciphertext,
 }
 
 std::vector<EvalKey<DCRTModule>> LeveledSHECKKSMod::EvalMultModKeyGen(const PrivateKey<DCRTModule> privateKey) const {
-    const auto cc           = privateKey->GetCryptoContext();
-    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(cc->GetCryptoParameters());
+    const auto cc = privateKey->GetCryptoContext();
 
+    // the rank of the key, which is below the rank of the context for rank-reduced keys
     const DCRTModule& s = privateKey->GetPrivateElement();
+    const usint rank    = s.GetModuleRows();
 
     auto algo = cc->GetScheme();
 
     std::vector<EvalKey<DCRTModule>> evalKeyVec;
     evalKeyVec.reserve(2);
 
+    // s (.) s and the products s_i * s_j, i < j, in one pass
+    DCRTModule sSquare, sCross;
+    if (rank > 1)
+        s.SymmetricOuterProduct(s, sSquare, sCross, false);
+    else
+        sSquare = s.HadamardProduct(s);
+
     PrivateKey<DCRTModule> privateKeyPower = std::make_shared<PrivateKeyImpl<DCRTModule>>(cc);
-    privateKeyPower->SetPrivateElement(std::move(s.HadamardProduct(s)));
+    privateKeyPower->SetPrivateElement(std::move(sSquare));
     evalKeyVec.push_back(algo->KeySwitchGen(privateKeyPower, privateKey));
 
-    if (cryptoParams->GetModuleRank() > 1) {
-        privateKeyPower->SetPrivateElement(std::move(s.LowerTriangleProduct(s)));
+    if (rank > 1) {
+        privateKeyPower->SetPrivateElement(std::move(sCross));
         evalKeyVec.push_back(algo->KeySwitchGen(privateKeyPower, privateKey));
     }
     return evalKeyVec;
 }
 
+void LeveledSHECKKSMod::RelinearizeInPlace(Ciphertext<DCRTModule>& ciphertext,
+                                           const std::vector<EvalKey<DCRTModule>>& evalKeyVec) const {
+    std::vector<DCRTModule>& cv = ciphertext->GetElements();
+    if (cv.size() <= 2)
+        return;
+    const size_t numKeys = cv.size() - 2;
+    if (evalKeyVec.size() < numKeys)
+        OPENFHE_THROW("RelinearizeInPlace: not enough evaluation keys for the ciphertext size");
+
+    // copies of the extra components are placed side by side in one module; the ciphertext
+    // itself is only changed once the key switch has succeeded
+    DCRTModule c(cv[2]);
+    c.SetFormat(Format::EVALUATION);
+    for (size_t j = 3; j < cv.size(); j++) {
+        DCRTModule cj(cv[j]);
+        cj.SetFormat(Format::EVALUATION);
+        c.AppendColumns(std::move(cj));
+    }
+
+    auto algo = ciphertext->GetCryptoContext()->GetScheme();
+
+    std::vector<EvalKey<DCRTModule>> evalKeys(evalKeyVec.begin(), evalKeyVec.begin() + numKeys);
+    std::shared_ptr<std::vector<DCRTModule>> ab = algo->KeySwitchCoreMany(c, evalKeys);
+
+    cv.resize(2);
+    for (auto& ci : cv)
+        ci.SetFormat(Format::EVALUATION);
+    cv[0] += (*ab)[0];
+    cv[1] += (*ab)[1];
+}
+
 /////////////////////////////////////
 // Mod Reduce
 /////////////////////////////////////
 
 EvalKey<DCRTModule> LeveledSHECKKSMod::EvalRankRedKeyGen(const PrivateKey<DCRTModule> privateKey,
-                                                         PrivateKey<DCRTModule>& reducedKey, usint newRank) const {
+                                                         PrivateKey<DCRTModule>& reducedKey, usint newRank,
+                                                         bool tagReducedKey) const {
     if (newRank < 1 || newRank >= privateKey->GetPrivateElement().GetModuleRows()) {
         OPENFHE_THROW("Invalid new rank for EvalRankRedKeyGen: " + std::to_string(newRank));
     }
@@ -174,11 +420,13 @@ EvalKey<DCRTModule> LeveledSHECKKSMod::EvalRankRedKeyGen(const PrivateKey<DCRTMo
 
     auto algo = cc->GetScheme();
 
-    DCRTModule sRem;
-    auto sRed = s.DropRows(s.GetModuleRows() - newRank, sRem);
+    DCRTModule sRed(s);
+    DCRTModule sRem = sRed.SplitRows(s.GetModuleRows() - newRank);
 
     reducedKey = std::make_shared<PrivateKeyImpl<DCRTModule>>(cc);
     reducedKey->SetPrivateElement(std::move(sRed));
+    reducedKey->SetKeyTag(tagReducedKey ? RankReducedKeyTag(privateKey->GetKeyTag(), newRank) :
+                                          privateKey->GetKeyTag());
 
     PrivateKey<DCRTModule> removedKey = std::make_shared<PrivateKeyImpl<DCRTModule>>(cc);
     removedKey->SetPrivateElement(std::move(sRem));
@@ -188,29 +436,157 @@ EvalKey<DCRTModule> LeveledSHECKKSMod::EvalRankRedKeyGen(const PrivateKey<DCRTMo
 
 Ciphertext<DCRTModule> LeveledSHECKKSMod::EvalRankReduce(ConstCiphertext<DCRTModule> ciphertext,
                                                          EvalKey<DCRTModule> reduceKey) const {
-    if (ciphertext->GetElements()[1].GetModuleCols() !=
-        reduceKey->GetAVector()[0].GetModuleRows() + reduceKey->GetAVector()[0].GetModuleCols()) {
+    // B is used for the ranks since A of a deserialized seed-compressed key is only restored by the key switch
+    const usint removedRank = reduceKey->GetBVector()[0].GetModuleRows();
+    if (ciphertext->GetElements()[1].GetModuleCols() <= removedRank) {
         OPENFHE_THROW("EvalRankRedKeyGen reduceKey does not match ciphertext rank");
     }
 
-    Ciphertext<DCRTModule> result = ciphertext->Clone();
+    Ciphertext<DCRTModule> result = ciphertext->CloneZero();
 
-    std::vector<DCRTModule>& cv = result->GetElements();
+    // the only copy of the ciphertext data; the removed columns are then split off by move
+    std::vector<DCRTModule> cv = ciphertext->GetElements();
     for (auto& c : cv)
         c.SetFormat(Format::EVALUATION);
 
     auto algo = result->GetCryptoContext()->GetScheme();
 
-    DCRTModule cRemoved;
-    auto cReduced = cv[1].DropColumns(reduceKey->GetAVector()[0].GetModuleRows(), cRemoved);
+    DCRTModule cRemoved = cv[1].SplitColumns(removedRank);
 
     std::shared_ptr<std::vector<DCRTModule>> ab = algo->KeySwitchCore(cRemoved, reduceKey);
     cv[0] += (*ab)[0];
-    cv[1] = cReduced + (*ab)[1];
+    cv[1] += (*ab)[1];
+
+    result->SetKeyTag(ReducedCiphertextKeyTag(ciphertext->GetKeyTag(), cv[1].GetModuleCols(), reduceKey));
+    result->SetElements(std::move(cv));
+    return result;
+}
+
+std::vector<Ciphertext<DCRTModule>> LeveledSHECKKSMod::EvalRankReduceBatch(
+    const std::vector<ConstCiphertext<DCRTModule>>& ciphertexts, EvalKey<DCRTModule> reduceKey) const {
+    const usint removedRank = reduceKey->GetBVector()[0].GetModuleRows();
+    for (const auto& ciphertext : ciphertexts) {
+        if (ciphertext->GetElements()[1].GetModuleCols() <= removedRank) {
+            OPENFHE_THROW("EvalRankRedKeyGen reduceKey does not match ciphertext rank");
+        }
+    }
+
+    const size_t count = ciphertexts.size();
+    std::vector<Ciphertext<DCRTModule>> result(count);
+    if (count == 0)
+        return result;
+
+    std::vector<std::vector<DCRTModule>> cv(count);
+    std::vector<DCRTModule> cRemoved(count);
+    for (size_t m = 0; m < count; ++m) {
+        result[m] = ciphertexts[m]->CloneZero();
+        cv[m]     = ciphertexts[m]->GetElements();
+        for (auto& c : cv[m])
+            c.SetFormat(Format::EVALUATION);
+        cRemoved[m] = cv[m][1].SplitColumns(removedRank);
+    }
+
+    auto algo = result[0]->GetCryptoContext()->GetScheme();
+
+    std::vector<std::shared_ptr<std::vector<DCRTModule>>> ab = algo->KeySwitchCoreBatch(cRemoved, reduceKey);
+    for (size_t m = 0; m < count; ++m) {
+        cv[m][0] += (*ab[m])[0];
+        cv[m][1] += (*ab[m])[1];
+        result[m]->SetKeyTag(ReducedCiphertextKeyTag(ciphertexts[m]->GetKeyTag(), cv[m][1].GetModuleCols(), reduceKey));
+        result[m]->SetElements(std::move(cv[m]));
+    }
+    return result;
+}
+
+EvalKey<DCRTModule> LeveledSHECKKSMod::EvalRankExtendKeyGen(const PrivateKey<DCRTModule> privateKey,
+                                                            const PrivateKey<DCRTModule> extendedKey) const {
+    if (extendedKey->GetPrivateElement().GetModuleRows() <= privateKey->GetPrivateElement().GetModuleRows()) {
+        OPENFHE_THROW("EvalRankExtendKeyGen: the extended key must have a higher rank than the private key");
+    }
+
+    return privateKey->GetCryptoContext()->GetScheme()->KeySwitchGen(privateKey, extendedKey);
+}
+
+Ciphertext<DCRTModule> LeveledSHECKKSMod::EvalRankExtend(ConstCiphertext<DCRTModule> ciphertext,
+                                                         EvalKey<DCRTModule> extendKey) const {
+    // B is used for the rank since A of a deserialized seed-compressed key is only restored by the key switch
+    if (ciphertext->GetElements()[1].GetModuleCols() != extendKey->GetBVector()[0].GetModuleRows()) {
+        OPENFHE_THROW("EvalRankExtendKeyGen extendKey does not match ciphertext rank");
+    }
+
+    Ciphertext<DCRTModule> result = ciphertext->CloneZero();
+
+    std::vector<DCRTModule> cv = ciphertext->GetElements();
+    for (auto& c : cv)
+        c.SetFormat(Format::EVALUATION);
+
+    auto algo = result->GetCryptoContext()->GetScheme();
+
+    // all columns are switched, so c1 is replaced by the key switched component of the higher rank
+    std::shared_ptr<std::vector<DCRTModule>> ab = algo->KeySwitchCore(cv[1], extendKey);
+    cv[0] += (*ab)[0];
+    cv[1] = std::move((*ab)[1]);
+
+    result->SetKeyTag(extendKey->GetKeyTag());
+    result->SetElements(std::move(cv));
+    return result;
+}
+
+std::vector<Ciphertext<DCRTModule>> LeveledSHECKKSMod::EvalFastRotationBatch(
+    ConstCiphertext<DCRTModule> ciphertext, const std::vector<int32_t>& indexList, const usint m,
+    const std::shared_ptr<std::vector<DCRTModule>> digits) const {
+    const auto cc = ciphertext->GetCryptoContext();
+
+    const auto& evalKeyMap = cc->GetEvalAutomorphismKeyMap(ciphertext->GetKeyTag());
+
+    // rotations by 0 are copies; the other indices are key switched together
+    std::vector<usint> autoIndices;
+    std::vector<EvalKey<DCRTModule>> evalKeys;
+    for (auto index : indexList) {
+        if (index == 0)
+            continue;
+        usint autoIndex      = FindAutomorphismIndex(index, m);
+        auto evalKeyIterator = evalKeyMap.find(autoIndex);
+        if (evalKeyIterator == evalKeyMap.end()) {
+            OPENFHE_THROW("EvalKey for index [" + std::to_string(autoIndex) + "] is not found.");
+        }
+        autoIndices.push_back(autoIndex);
+        evalKeys.push_back(evalKeyIterator->second);
+    }
+
+    const std::vector<DCRTModule>& cv = ciphertext->GetElements();
 
+    std::vector<std::shared_ptr<std::vector<DCRTModule>>> ba =
+        cc->GetScheme()->EvalFastKeySwitchCoreBatch(digits, evalKeys, cv[0].GetParams());
+
+    usint N = cv[0].GetRingDimension();
+    std::vector<usint> vec(N);
+
+    std::vector<Ciphertext<DCRTModule>> result;
+    result.reserve(indexList.size());
+    for (size_t i = 0, k = 0; i < indexList.size(); ++i) {
+        if (indexList[i] == 0) {
+            result.push_back(ciphertext->Clone());
+            continue;
+        }
+        PrecomputeAutoMap(N, autoIndices[k], &vec);
+
+        std::vector<DCRTModule>& cTilda = *ba[k];
+        cTilda[0] += cv[0];
+
+        Ciphertext<DCRTModule> rotated = ciphertext->CloneZero();
+        rotated->SetElements(
+            {cTilda[0].AutomorphismTransform(autoIndices[k], vec), cTilda[1].AutomorphismTransform(autoIndices[k], vec)});
+        result.push_back(std::move(rotated));
+        ba[k++].reset();
+    }
     return result;
 }
 
+usint LeveledSHECKKSMod::FindAutomorphismIndex(usint index, usint m) const {
+    return FindAutomorphismIndex2nComplex(index, m);
+}
+
 void LeveledSHECKKSMod::AdjustLevelsAndDepthInPlace(Ciphertext<DCRTModule>& ciphertext1,
                                                     Ciphertext<DCRTModule>& ciphertext2) const {
     const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(ciphertext1->GetCryptoParameters());
@@ -374,10 +750,16 @@ void LeveledSHECKKSMod::ModReduceInternalInPlace(Ciphertext<DCRTModule>& ciphert
     size_t sizeQl = cv[0].GetNumOfElements();
     size_t diffQl = sizeQ - sizeQl;
 
+    const bool sharedParams = cryptoParams->HasParamsQl(cv[0].GetParams());
     for (size_t l = 0; l < levels; ++l) {
         for (size_t i = 0; i < cv.size(); ++i) {
-            cv[i].DropLastElementAndScale(cryptoParams->GetQlQlInvModqlDivqlModq(diffQl + l),
-                                          cryptoParams->GetqlInvModq(diffQl + l));
+            if (sharedParams)
+                cv[i].DropLastElementAndScale(cryptoParams->GetQlQlInvModqlDivqlModq(diffQl + l),
+                                              cryptoParams->GetqlInvModq(diffQl + l),
+                                              cryptoParams->GetParamsQl(sizeQl - l - 1));
+            else
+                cv[i].DropLastElementAndScale(cryptoParams->GetQlQlInvModqlDivqlModq(diffQl + l),
+                                              cryptoParams->GetqlInvModq(diffQl + l));
         }
     }
 
@@ -391,14 +773,72 @@ void LeveledSHECKKSMod::ModReduceInternalInPlace(Ciphertext<DCRTModule>& ciphert
 }
 
 void LeveledSHECKKSMod::LevelReduceInternalInPlace(Ciphertext<DCRTModule>& ciphertext, size_t levels) const {
+    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(ciphertext->GetCryptoParameters());
+
     std::vector<DCRTModule>& elements = ciphertext->GetElements();
-    for (auto& element : elements) {
-        element.DropLastElements(levels);
+    if (cryptoParams->HasParamsQl(elements[0].GetParams())) {
+        const auto paramsQl = cryptoParams->GetParamsQl(elements[0].GetNumOfElements() - levels);
+        for (auto& element : elements) {
+            element.DropLastElements(levels, paramsQl);
+        }
+    }
+    else {
+        for (auto& element : elements) {
+            element.DropLastElements(levels);
+        }
     }
     ciphertext->SetLevel(ciphertext->GetLevel() + levels);
 }
 
 #if NATIVEINT == 128 && !defined(__EMSCRIPTEN__)
+std::vector<DCRTModule::Integer> LeveledSHECKKSMod::GetElementForEvalAddOrSub(ConstCiphertext<DCRTModule> ciphertext,
+                                                                              double operand) const {
+    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(ciphertext->GetCryptoParameters());
+
+    uint32_t precision = 52;
+    double powP        = std::pow(2, precision);
+
+    const std::vector<DCRTModule>& cv = ciphertext->GetElements();
+    usint numTowers                   = cv[0].GetNumOfElements();
+    std::vector<DCRTModule::Integer> moduli(numTowers);
+
+    for (usint i = 0; i < numTowers; i++) {
+        moduli[i] = cv[0].GetElementAtIndex(0, 0, i).GetModulus();
+    }
+
+    // the idea is to break down real numbers
+    // expressed as input_mantissa * 2^input_exponent
+    // into (input_mantissa * 2^52) * 2^(p - 52 + input_exponent)
+    // to preserve 52-bit precision of doubles
+    // when converting to 128-bit numbers
+    int32_t n1       = 0;
+    int64_t scaled64 = std::llround(static_cast<double>(std::frexp(operand, &n1)) * powP);
+
+    int32_t pCurrent   = cryptoParams->GetPlaintextModulus() - precision;
+    int32_t pRemaining = pCurrent + n1;
+
+    DCRTModule::Integer scaledConstant;
+    if (pRemaining < 0) {
+        scaledConstant = NativeInteger(((uint128_t)scaled64) >> (-pRemaining));
+    }
+    else {
+        int128_t ppRemaining = ((int128_t)1) << pRemaining;
+        scaledConstant       = NativeInteger((int128_t)scaled64 * ppRemaining);
+    }
+
+    // the residues of the scaling factor 2^p precomputed for the level
+    const std::vector<NativeInteger>& crtScFactor = cryptoParams->GetScalingFactorIntCRT(ciphertext->GetLevel());
+    std::vector<DCRTModule::Integer> crtPowP(crtScFactor.begin(), crtScFactor.begin() + numTowers);
+    std::vector<DCRTModule::Integer> currPowP(numTowers, scaledConstant);
+
+    // multiply c*powP with powP a total of (depth-1) times to get c*powP^d
+    for (size_t i = 0; i < ciphertext->GetNoiseScaleDeg() - 1; i++) {
+        currPowP = CKKSPackedEncoding::CRTMult(currPowP, crtPowP, moduli);
+    }
+
+    return currPowP;
+}
+
 std::vector<DCRTModule::Integer> LeveledSHECKKSMod::GetElementForEvalMult(ConstCiphertext<DCRTModule> ciphertext,
                                                                           double operand) const {
     const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(ciphertext->GetCryptoParameters());
@@ -446,18 +886,14 @@ std::vector<DCRTModule::Integer> LeveledSHECKKSMod::GetElementForEvalMult(ConstC
     return factors;
 }
 #else  // NATIVEINT == 64
-std::vector<DCRTModule::Integer> LeveledSHECKKSMod::GetElementForEvalMult(ConstCiphertext<DCRTModule> ciphertext,
-                                                                          double operand) const {
-    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(ciphertext->GetCryptoParameters());
-
-    const std::vector<DCRTModule>& cv = ciphertext->GetElements();
-    uint32_t numTowers                = cv[0].GetNumOfElements();
-    std::vector<DCRTModule::Integer> moduli(numTowers);
-    for (usint i = 0; i < numTowers; i++) {
-        moduli[i] = cv[0].GetElementAtIndex(0, 0, i).GetModulus();
-    }
-
-    double scFactor = cryptoParams->GetScalingFactorReal(ciphertext->GetLevel());
+namespace {  // this namespace should stay unnamed
+/**
+ * CRT residues of round(operand * scFactor) for the given moduli. A product that does not fit
+ * into a machine word is scaled down by a power of two, which is multiplied back in CRT form.
+ */
+std::vector<DCRTModule::Integer> ScaledConstantCRT(double operand, double scFactor,
+                                                   const std::vector<DCRTModule::Integer>& moduli) {
+    const uint32_t numTowers = moduli.size();
 
     #if defined(HAVE_INT128)
     typedef int128_t DoubleInteger;
@@ -537,6 +973,59 @@ std::vector<DCRTModule::Integer> LeveledSHECKKSMod::GetElementForEvalMult(ConstC
 
     return factors;
 }
+}  // namespace
+
+std::vector<DCRTModule::Integer> LeveledSHECKKSMod::GetElementForEvalAddOrSub(ConstCiphertext<DCRTModule> ciphertext,
+                                                                              double operand) const {
+    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(ciphertext->GetCryptoParameters());
+
+    const std::vector<DCRTModule>& cv = ciphertext->GetElements();
+    uint32_t numTowers                = cv[0].GetNumOfElements();
+    std::vector<DCRTModule::Integer> moduli(numTowers);
+    for (usint i = 0; i < numTowers; i++) {
+        moduli[i] = cv[0].GetElementAtIndex(0, 0, i).GetModulus();
+    }
+
+    const usint level     = ciphertext->GetLevel();
+    const bool extLevel0  = cryptoParams->GetScalingTechnique() == FLEXIBLEAUTOEXT && level == 0;
+    const double scFactor = extLevel0 ? cryptoParams->GetScalingFactorRealBig(level) :
+                                        cryptoParams->GetScalingFactorReal(level);
+
+    std::vector<DCRTModule::Integer> crtConstant = ScaledConstantCRT(operand, scFactor, moduli);
+
+    // In FLEXIBLEAUTOEXT mode at level 0, we don't use the depth to calculate the scaling factor,
+    // so we return the value before taking the depth into account.
+    if (extLevel0 || ciphertext->GetNoiseScaleDeg() < 2)
+        return crtConstant;
+
+    // raise the constant to the depth of the ciphertext with the residues precomputed for the level
+    const std::vector<NativeInteger>& crtScFactor = cryptoParams->GetScalingFactorIntCRT(level);
+    for (usint i = 0; i < numTowers; i++) {
+        const NativeInteger q{moduli[i]};
+        NativeInteger c{crtConstant[i]};
+        for (usint d = 1; d < ciphertext->GetNoiseScaleDeg(); d++)
+            c.ModMulFastEq(crtScFactor[i], q);
+        crtConstant[i] = c;
+    }
+
+    return crtConstant;
+}
+
+std::vector<DCRTModule::Integer> LeveledSHECKKSMod::GetElementForEvalMult(ConstCiphertext<DCRTModule> ciphertext,
+                                                                          double operand) const {
+    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSMod>(ciphertext->GetCryptoParameters());
+
+    const std::vector<DCRTModule>& cv = ciphertext->GetElements();
+    uint32_t numTowers                = cv[0].GetNumOfElements();
+    std::vector<DCRTModule::Integer> moduli(numTowers);
+    for (usint i = 0; i < numTowers; i++) {
+        moduli[i] = cv[0].GetElementAtIndex(0, 0, i).GetModulus();
+    }
+
+    double scFactor = cryptoParams->GetScalingFactorReal(ciphertext->GetLevel());
+
+    return ScaledConstantCRT(operand, scFactor, moduli);
+}
 
 #endif
 
@@ -69,6 +69,17 @@ bool ParameterGenerationCKKSMod::ParamsGenCKKSMod(std::shared_ptr<CryptoParamete
         OPENFHE_THROW(s.str());
     }
 
+    if (ksTech != BV && ksTech != HYBRID && ksTech != GHS) {
+        std::stringstream s;
+        s << "Key switching technique " << ksTech << " is not supported for CKKSMOD";
+        OPENFHE_THROW(s.str());
+    }
+
+    // GHS key switching uses a single digit: the whole Q_l is raised to Q_l*P at once, and P is
+    // chosen large enough to absorb the key switching noise of the full modulus
+    if (ksTech == GHS)
+        numPartQ = 1;
+
     // TODO: Allow the user to specify this?
     uint32_t extraModSize = (scalTech == FLEXIBLEAUTOEXT) ? DCRT_MODULUS::DEFAULT_EXTRA_MOD_SIZE : 0;
 
@@ -83,8 +94,8 @@ bool ParameterGenerationCKKSMod::ParamsGenCKKSMod(std::shared_ptr<CryptoParamete
     if (qBound != auxBits)
         qBound++;
 
-    // Estimate ciphertext modulus Q*P bound (in case of HYBRID P*Q)
-    if (ksTech == HYBRID) {
+    // Estimate ciphertext modulus Q*P bound (P*Q for both HYBRID and GHS; BV has no P)
+    if (ksTech != BV) {
         auto hybridKSInfo = CryptoParametersRNS::EstimateLogP(numPartQ, firstModSize, scalingModSize, extraModSize,
                                                               numPrimes, auxBits, true);
         qBound += std::get<0>(hybridKSInfo);
@@ -263,7 +274,7 @@ bool ParameterGenerationCKKSMod::ParamsGenCKKSMod(std::shared_ptr<CryptoParamete
     // Validate the ring dimension found using estimated logQ(P) against actual logQ(P)
     if (stdLevel != HEStd_NotSet) {
         uint32_t logActualQ = 0;
-        if (ksTech == HYBRID) {
+        if (ksTech != BV) {
             logActualQ = cryptoParamsCKKSMod->GetParamsQP()->GetModulus().GetMSB();
         }
         else {
@@ -80,8 +80,11 @@ KeyPair<DCRTModule> PKECKKSMOD::KeyGenInternal(CryptoContext<DCRTModule> cc, boo
     // Public Key Generation
 
     DCRTModule A(dug, paramsPK, Format::EVALUATION, cryptoParams->GetModuleRank(), cryptoParams->GetModuleRank());
-    DCRTModule e(dgg, paramsPK, Format::EVALUATION, cryptoParams->GetModuleRank());
-    DCRTModule b(ns * e - A * s);
+    // b = ns * e - A * s, accumulated in place over the sampled error
+    DCRTModule b(dgg, paramsPK, Format::EVALUATION, cryptoParams->GetModuleRank());
+    if (ns != 1)
+        b *= DCRTModule::Integer(ns);
+    b.MultiplySubtractInPlace(A, s);
 
     keyPair.secretKey->SetPrivateElement(std::move(s));
     keyPair.publicKey->SetPublicElements(std::vector<DCRTModule>{std::move(b), std::move(A)});
@@ -125,7 +128,9 @@ std::shared_ptr<std::vector<DCRTModule>> PKECKKSMOD::EncryptZeroCore(const Publi
 
     TugType tug;
 
-    const std::shared_ptr<ParmType> elementParams = (params == nullptr) ? cryptoParams->GetElementParams() : params;
+    // plaintexts encoded at a lower level carry their own params; share the cached prefix instead
+    const std::shared_ptr<ParmType> elementParams =
+        (params == nullptr) ? cryptoParams->GetElementParams() : cryptoParams->InternParamsQl(params);
     // TODO (dsuponit): "tug" must be assigned with TernaryUniformGenerator. Otherwise the DCRTModule constructor crashes.
     // check other files if "tug" is properly assigned
     // if (cryptoParams->GetSecretKeyDist() != GAUSSIAN) {
@@ -136,33 +141,17 @@ std::shared_ptr<std::vector<DCRTModule>> PKECKKSMOD::EncryptZeroCore(const Publi
                        DCRTModule(tug, elementParams, Format::EVALUATION, 0, 1, cryptoParams->GetModuleRank());
 
     // noise generation with the discrete gaussian generator dgg
-    DCRTModule e0(dgg, elementParams, Format::EVALUATION, 1);
-    DCRTModule e1(dgg, elementParams, Format::EVALUATION, 1, cryptoParams->GetModuleRank());
-
-    uint32_t sizeQ  = pk[0].GetParams()->GetParams().size();
-    uint32_t sizeQl = elementParams->GetParams().size();
-
-    DCRTModule c0, c1;
-    if (sizeQl != sizeQ) {
-        // Clone public keys because we need to drop towers.
-        DCRTModule p0 = pk[0].Clone();
-        DCRTModule p1 = pk[1].Clone();
-
-        uint32_t diffQl = sizeQ - sizeQl;
-        p0.DropLastElements(diffQl);
-        p1.DropLastElements(diffQl);
-
-        c0 = v * p0 + ns * e0;
-        c1 = v * p1 + ns * e1;
+    DCRTModule c0(dgg, elementParams, Format::EVALUATION, 1);
+    DCRTModule c1(dgg, elementParams, Format::EVALUATION, 1, cryptoParams->GetModuleRank());
+    if (ns != 1) {
+        c0 *= DCRTModule::Integer(ns);
+        c1 *= DCRTModule::Integer(ns);
     }
-    else {
-        // Use public keys as they are
-        const DCRTModule& p0 = pk[0];
-        const DCRTModule& p1 = pk[1];
 
-        c0 = v * p0 + ns * e0;
-        c1 = v * p1 + ns * e1;
-    }
+    // c_i = v * pk_i + ns * e_i; the products only read the first sizeQl towers of
+    // the public key, so no truncated copy of the key is needed at lower levels
+    c0.MultiplyAddInPlace(v, pk[0]);
+    c1.MultiplyAddInPlace(v, pk[1]);
 
     return std::make_shared<std::vector<DCRTModule>>(std::initializer_list<DCRTModule>({std::move(c0), std::move(c1)}));
 }
@@ -201,20 +190,32 @@ DecryptResult PKECKKSMOD::Decrypt(ConstCiphertext<DCRTModule> ciphertext, const
 }
 
 DCRTModule PKECKKSMOD::DecryptCore(const std::vector<DCRTModule>& cv, const PrivateKey<DCRTModule> privateKey) const {
-    if (cv.size() != 2) {
-        OPENFHE_THROW("Decryption of ciphertext with more than 2 elements is not supported");
-    }
-    DCRTModule s = privateKey->GetPrivateElement();
-
-    size_t sizeQ  = s.GetParams()->GetParams().size();
-    size_t sizeQl = cv[0].GetParams()->GetParams().size();
-
-    size_t diffQl = sizeQ - sizeQl;
+    const DCRTModule& s = privateKey->GetPrivateElement();
 
-    auto scopy(s);
-    scopy.DropLastElements(diffQl);
+    // a product that is not relinearized has c1 (.) c1' and, for rank > 1, the lower triangle
+    const size_t tensorSize = (s.GetModuleRows() > 1) ? 4 : 3;
+    if (cv.size() != 2 && cv.size() != tensorSize) {
+        OPENFHE_THROW("Decryption of ciphertexts with " + std::to_string(cv.size()) +
+                      " elements is not supported for this rank");
+    }
 
-    return cv[0] + cv[1] * scopy;
+    // the products only read the towers of cv[0], so s and its powers are used without dropping towers
+    DCRTModule b(cv[0]);
+    b.MultiplyAddInPlace(cv[1], s);
+    if (cv.size() > 2) {
+        // s (.) s and the products s_i * s_j, i < j, in one pass, as for the relinearization keys
+        const auto powers = privateKey->GetPrivateElementPowers([&s, tensorSize]() {
+            std::vector<DCRTModule> result(tensorSize - 2);
+            if (tensorSize > 3)
+                s.SymmetricOuterProduct(s, result[0], result[1], false);
+            else
+                result[0] = s.HadamardProduct(s);
+            return result;
+        });
+        for (size_t i = 2; i < cv.size(); ++i)
+            b.MultiplyAddInPlace(cv[i], (*powers)[i - 2]);
+    }
+    return b;
 }
 
 }  // namespace lbcrypto
@@ -77,6 +77,7 @@ namespace lbcrypto {
         SET_TO_SCHEME_DEFAULT(SCHEME, thresholdNumOfParties);           \
         SET_TO_SCHEME_DEFAULT(SCHEME, interactiveBootCompressionLevel); \
         SET_TO_SCHEME_DEFAULT(SCHEME, moduleRank); \
+        SET_TO_SCHEME_DEFAULT(SCHEME, compressEvalKeys); \
     }
 void Params::SetToDefaults(SCHEME scheme) {
     switch (scheme) {
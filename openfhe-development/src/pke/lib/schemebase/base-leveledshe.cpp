@@ -347,6 +347,14 @@ Ciphertext<Element> LeveledSHEBase<Element>::EvalMultAndRelinearize(
     return result;
 }
 
+template <class Element>
+Ciphertext<Element> LeveledSHEBase<Element>::EvalSquareAndRelinearize(
+    ConstCiphertext<Element> ciphertext, const std::vector<EvalKey<Element>>& evalKeyVec) const {
+    Ciphertext<Element> result = EvalSquare(ciphertext);
+    RelinearizeInPlace(result, evalKeyVec);
+    return result;
+}
+
 template <class Element>
 Ciphertext<Element> LeveledSHEBase<Element>::Relinearize(ConstCiphertext<Element> ciphertext,
                                                          const std::vector<EvalKey<Element>>& evalKeyVec) const {
@@ -521,6 +529,17 @@ Ciphertext<Element> LeveledSHEBase<Element>::EvalFastRotation(
     return result;
 }
 
+template <class Element>
+std::vector<Ciphertext<Element>> LeveledSHEBase<Element>::EvalFastRotationBatch(
+    ConstCiphertext<Element> ciphertext, const std::vector<int32_t>& indexList, const usint m,
+    const std::shared_ptr<std::vector<Element>> digits) const {
+    std::vector<Ciphertext<Element>> result;
+    result.reserve(indexList.size());
+    for (auto index : indexList)
+        result.push_back(EvalFastRotation(ciphertext, index, m, digits));
+    return result;
+}
+
 template <class Element>
 std::shared_ptr<std::map<usint, EvalKey<Element>>> LeveledSHEBase<Element>::EvalAtIndexKeyGen(
     const PublicKey<Element> publicKey, const PrivateKey<Element> privateKey,
@@ -66,13 +66,15 @@ Ciphertext<Element> SchemeBase<Element>::ReEncrypt(ConstCiphertext<Element> ciph
 }
 
 template <typename Element>
-EvalKey<Element> SchemeBase<Element>::EvalRankRedKeyGen(const PrivateKey<Element> privateKey, PrivateKey<Element>& reducedKey, usint newRank) const {
+EvalKey<Element> SchemeBase<Element>::EvalRankRedKeyGen(const PrivateKey<Element> privateKey, PrivateKey<Element>& reducedKey, usint newRank,
+                                                        bool tagReducedKey) const {
     VerifyLeveledSHEEnabled(__func__);
     if (!privateKey)
         OPENFHE_THROW("Input private key is nullptr");
 
-    auto evalKey = m_LeveledSHE->EvalRankRedKeyGen(privateKey, reducedKey, newRank);
-    evalKey->SetKeyTag(privateKey->GetKeyTag());
+    // the key switches to the reduced key, so it carries its tag
+    auto evalKey = m_LeveledSHE->EvalRankRedKeyGen(privateKey, reducedKey, newRank, tagReducedKey);
+    evalKey->SetKeyTag(reducedKey->GetKeyTag());
     return evalKey;
 }
 
@@ -82,6 +84,45 @@ Ciphertext<Element> SchemeBase<Element>::EvalRankReduce(ConstCiphertext<Element>
     return m_LeveledSHE->EvalRankReduce(ciphertext, reduceKey);
 }
 
+template <typename Element>
+std::vector<Ciphertext<Element>> SchemeBase<Element>::EvalRankReduceBatch(
+    const std::vector<ConstCiphertext<Element>>& ciphertexts, EvalKey<Element> reduceKey) const {
+    VerifyLeveledSHEEnabled(__func__);
+    if (!reduceKey)
+        OPENFHE_THROW("Input evaluation key is nullptr");
+    for (const auto& ciphertext : ciphertexts) {
+        if (!ciphertext)
+            OPENFHE_THROW("Input ciphertext is nullptr");
+    }
+    return m_LeveledSHE->EvalRankReduceBatch(ciphertexts, reduceKey);
+}
+
+template <typename Element>
+EvalKey<Element> SchemeBase<Element>::EvalRankExtendKeyGen(const PrivateKey<Element> privateKey,
+                                                           const PrivateKey<Element> extendedKey) const {
+    VerifyLeveledSHEEnabled(__func__);
+    if (!privateKey)
+        OPENFHE_THROW("Input private key is nullptr");
+    if (!extendedKey)
+        OPENFHE_THROW("Input extended private key is nullptr");
+
+    auto evalKey = m_LeveledSHE->EvalRankExtendKeyGen(privateKey, extendedKey);
+    // extended ciphertexts are encrypted under extendedKey and take this tag
+    evalKey->SetKeyTag(extendedKey->GetKeyTag());
+    return evalKey;
+}
+
+template <typename Element>
+Ciphertext<Element> SchemeBase<Element>::EvalRankExtend(ConstCiphertext<Element> ciphertext,
+                                                        EvalKey<Element> extendKey) const {
+    VerifyLeveledSHEEnabled(__func__);
+    if (!ciphertext)
+        OPENFHE_THROW("Input ciphertext is nullptr");
+    if (!extendKey)
+        OPENFHE_THROW("Input evaluation key is nullptr");
+    return m_LeveledSHE->EvalRankExtend(ciphertext, extendKey);
+}
+
 template <typename Element>
 EvalKey<Element> SchemeBase<Element>::EvalMultKeyGen(const PrivateKey<Element> privateKey) const {
     VerifyLeveledSHEEnabled(__func__);
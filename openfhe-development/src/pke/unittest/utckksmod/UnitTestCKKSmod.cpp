@@ -36,6 +36,9 @@
 #include "UnitTestUtils.h"
 #include "UnitTestCCParams.h"
 #include "UnitTestCryptoContext.h"
+#include "scheme/ckksmod/ckksmod-convert.h"
+#include "scheme/ckksmod/ckksmod-cryptoparameters.h"
+#include "keyswitch/keyswitch-mod.h"
 
 #include <iostream>
 #include <vector>
@@ -52,6 +55,15 @@ enum TEST_CASE_TYPE {
     ADD_PACKED_PRECISION,
     MULT_PACKED_PRECISION,
     SMALL_SCALING_MOD_SIZE,
+    RANK_CONVERT,
+    RANK_EXTEND,
+    RANK_REDUCE_BATCH,
+    MULT_PLAINTEXT,
+    EVAL_SCALAR,
+    EVAL_SQUARE,
+    EVAL_ROTATE,
+    DECRYPT_NO_RELIN,
+    KEYGEN_SEEDED,
 };
 
 static std::ostream& operator<<(std::ostream& os, const TEST_CASE_TYPE& type) {
@@ -75,6 +87,33 @@ static std::ostream& operator<<(std::ostream& os, const TEST_CASE_TYPE& type) {
         case SMALL_SCALING_MOD_SIZE:
             typeName = "SMALL_SCALING_MOD_SIZE";
             break;
+        case RANK_CONVERT:
+            typeName = "RANK_CONVERT";
+            break;
+        case RANK_EXTEND:
+            typeName = "RANK_EXTEND";
+            break;
+        case RANK_REDUCE_BATCH:
+            typeName = "RANK_REDUCE_BATCH";
+            break;
+        case MULT_PLAINTEXT:
+            typeName = "MULT_PLAINTEXT";
+            break;
+        case EVAL_SCALAR:
+            typeName = "EVAL_SCALAR";
+            break;
+        case EVAL_SQUARE:
+            typeName = "EVAL_SQUARE";
+            break;
+        case EVAL_ROTATE:
+            typeName = "EVAL_ROTATE";
+            break;
+        case DECRYPT_NO_RELIN:
+            typeName = "DECRYPT_NO_RELIN";
+            break;
+        case KEYGEN_SEEDED:
+            typeName = "KEYGEN_SEEDED";
+            break;
         default:
             typeName = "UNKNOWN";
             break;
@@ -165,8 +204,11 @@ static std::vector<TEST_CASE_UTCKKSMod> testCases = {
 #endif
     // ==========================================
     // TestType,  Descr, Scheme,          RDim, MultDepth, SModSize, DSize, BatchSz, SecKeyDist, MaxRelinSkDeg, FModSize, SecLvl,       KSTech, ScalTech,        LDigits, PtMod, StdDev, EvalAddCt, KSCt, MultTech, EncTech, PREMode, multiparty, decryptnoise, execmode, noiseestimate, rank, Slots
+    { MULT_PACKED, "01", {CKKSMOD_SCHEME, RING_DIM, 7,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, BV,     FIXEDMANUAL,     DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   0},
+    { MULT_PACKED, "02", {CKKSMOD_SCHEME, RING_DIM, 7,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, BV,     FIXEDAUTO,       DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   0},
     { MULT_PACKED, "03", {CKKSMOD_SCHEME, RING_DIM, 7,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FIXEDMANUAL,     DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   0},
     { MULT_PACKED, "04", {CKKSMOD_SCHEME, RING_DIM, 7,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FIXEDAUTO,       DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   0},
+    { MULT_PACKED, "05", {CKKSMOD_SCHEME, RING_DIM, 7,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, GHS,    FIXEDMANUAL,     DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   0},
 #if NATIVEINT != 128
     { MULT_PACKED, "06", {CKKSMOD_SCHEME, RING_DIM, 7,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FLEXIBLEAUTO,    DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   0},
     { MULT_PACKED, "08", {CKKSMOD_SCHEME, RING_DIM, 7,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FLEXIBLEAUTOEXT, DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   0},
@@ -232,6 +274,69 @@ static std::vector<TEST_CASE_UTCKKSMod> testCases = {
     { SMALL_SCALING_MOD_SIZE, "02", {CKKSMOD_SCHEME, 32768, 16,        50,       DFLT,  DFLT,    DFLT,       DFLT,          50,       HEStd_NotSet, DFLT,   DFLT,        DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK}, },
 #endif
     // ==========================================
+    // TestType,    Descr, Scheme,          RDim, MultDepth, SModSize, DSize, BatchSz, SecKeyDist, MaxRelinSkDeg, FModSize, SecLvl,       KSTech, ScalTech,        LDigits, PtMod, StdDev, EvalAddCt, KSCt, MultTech, EncTech, PREMode, multiparty, decryptnoise, execmode, noiseestimate, rank, Slots
+    { RANK_CONVERT, "01", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FIXEDMANUAL,     DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+    { RANK_CONVERT, "02", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, BV,     FIXEDAUTO,       DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+#if NATIVEINT != 128
+    { RANK_CONVERT, "03", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, GHS,    FLEXIBLEAUTOEXT, DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+#endif
+    // ==========================================
+    // TestType,   Descr, Scheme,          RDim, MultDepth, SModSize, DSize, BatchSz, SecKeyDist, MaxRelinSkDeg, FModSize, SecLvl,       KSTech, ScalTech,        LDigits, PtMod, StdDev, EvalAddCt, KSCt, MultTech, EncTech, PREMode, multiparty, decryptnoise, execmode, noiseestimate, rank, Slots
+    { RANK_EXTEND, "01", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FIXEDAUTO,       DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+    { RANK_EXTEND, "02", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, BV,     FIXEDAUTO,       DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+#if NATIVEINT != 128
+    { RANK_EXTEND, "03", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FLEXIBLEAUTOEXT, DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+#endif
+    // ==========================================
+    // TestType,         Descr, Scheme,         RDim,     MultDepth, SModSize, DSize, BatchSz, SecKeyDist, MaxRelinSkDeg, FModSize, SecLvl,       KSTech, ScalTech,        LDigits, PtMod, StdDev, EvalAddCt, KSCt, MultTech, EncTech, PREMode, multiparty, decryptnoise, execmode, noiseestimate, rank, Slots
+    { RANK_REDUCE_BATCH, "01", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FIXEDMANUAL,     DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+    { RANK_REDUCE_BATCH, "02", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, BV,     FIXEDAUTO,       DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+    { RANK_REDUCE_BATCH, "03", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, GHS,    FIXEDMANUAL,     DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+    // ==========================================
+    // TestType,      Descr, Scheme,         RDim,     MultDepth, SModSize, DSize, BatchSz, SecKeyDist, MaxRelinSkDeg, FModSize, SecLvl,       KSTech, ScalTech,        LDigits, PtMod, StdDev, EvalAddCt, KSCt, MultTech, EncTech, PREMode, multiparty, decryptnoise, execmode, noiseestimate, rank, Slots
+    { MULT_PLAINTEXT, "01", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FIXEDMANUAL,     DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+    { MULT_PLAINTEXT, "02", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, BV,     FIXEDAUTO,       DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+#if NATIVEINT != 128
+    { MULT_PLAINTEXT, "03", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FLEXIBLEAUTO,    DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+    { MULT_PLAINTEXT, "04", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FLEXIBLEAUTOEXT, DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+#endif
+    // ==========================================
+    // TestType,      Descr, Scheme,         RDim,     MultDepth, SModSize, DSize, BatchSz, SecKeyDist, MaxRelinSkDeg, FModSize, SecLvl,       KSTech, ScalTech,        LDigits, PtMod, StdDev, EvalAddCt, KSCt, MultTech, EncTech, PREMode, multiparty, decryptnoise, execmode, noiseestimate, rank, Slots
+    { EVAL_SCALAR,    "01", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FIXEDMANUAL,     DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+    { EVAL_SCALAR,    "02", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, BV,     FIXEDAUTO,       DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+#if NATIVEINT != 128
+    { EVAL_SCALAR,    "03", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FLEXIBLEAUTO,    DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+    { EVAL_SCALAR,    "04", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FLEXIBLEAUTOEXT, DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+#endif
+    // ==========================================
+    // TestType,      Descr, Scheme,         RDim,     MultDepth, SModSize, DSize, BatchSz, SecKeyDist, MaxRelinSkDeg, FModSize, SecLvl,       KSTech, ScalTech,        LDigits, PtMod, StdDev, EvalAddCt, KSCt, MultTech, EncTech, PREMode, multiparty, decryptnoise, execmode, noiseestimate, rank, Slots
+    { EVAL_SQUARE,    "01", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FIXEDMANUAL,     DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+    { EVAL_SQUARE,    "02", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, BV,     FIXEDAUTO,       DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+#if NATIVEINT != 128
+    { EVAL_SQUARE,    "03", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FLEXIBLEAUTO,    DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+    { EVAL_SQUARE,    "04", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, GHS,    FLEXIBLEAUTOEXT, DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+#endif
+    // ==========================================
+    // TestType,      Descr, Scheme,         RDim,     MultDepth, SModSize, DSize, BatchSz, SecKeyDist, MaxRelinSkDeg, FModSize, SecLvl,       KSTech, ScalTech,        LDigits, PtMod, StdDev, EvalAddCt, KSCt, MultTech, EncTech, PREMode, multiparty, decryptnoise, execmode, noiseestimate, rank, Slots
+    { EVAL_ROTATE,    "01", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FIXEDMANUAL,     DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+    { EVAL_ROTATE,    "02", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, BV,     FIXEDAUTO,       DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+#if NATIVEINT != 128
+    { EVAL_ROTATE,    "03", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FLEXIBLEAUTO,    DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+    { EVAL_ROTATE,    "04", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, GHS,    FLEXIBLEAUTOEXT, DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+#endif
+    // ==========================================
+    // TestType,      Descr, Scheme,         RDim,     MultDepth, SModSize, DSize, BatchSz, SecKeyDist, MaxRelinSkDeg, FModSize, SecLvl,       KSTech, ScalTech,        LDigits, PtMod, StdDev, EvalAddCt, KSCt, MultTech, EncTech, PREMode, multiparty, decryptnoise, execmode, noiseestimate, rank, Slots
+    { DECRYPT_NO_RELIN, "01", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FIXEDMANUAL,     DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+    { DECRYPT_NO_RELIN, "02", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, BV,     FIXEDAUTO,       DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+    { DECRYPT_NO_RELIN, "03", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FIXEDMANUAL,     DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          1}          ,   BATCH},
+#if NATIVEINT != 128
+    { DECRYPT_NO_RELIN, "04", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FLEXIBLEAUTO,    DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+#endif
+    // ==========================================
+    // TestType,      Descr, Scheme,         RDim,     MultDepth, SModSize, DSize, BatchSz, SecKeyDist, MaxRelinSkDeg, FModSize, SecLvl,       KSTech, ScalTech,        LDigits, PtMod, StdDev, EvalAddCt, KSCt, MultTech, EncTech, PREMode, multiparty, decryptnoise, execmode, noiseestimate, rank, Slots
+    { KEYGEN_SEEDED, "01", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FIXEDMANUAL,     DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+    { KEYGEN_SEEDED, "02", {CKKSMOD_SCHEME, RING_DIM, 3,     DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, BV,     FIXEDAUTO,       DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK},   BATCH},
+    // ==========================================
 };
 // clang-format on
 //===========================================================================================================
@@ -332,6 +437,7 @@ protected:
 
     void TearDown() {
         CryptoContextFactory<DCRTModule>::ReleaseAllContexts();
+        CryptoContextFactory<DCRTPoly>::ReleaseAllContexts();
     }
 
     template <typename T>
@@ -527,6 +633,21 @@ protected:
             ciphertext2 = cc->EvalMultAndRelinearize(ciphertext2, ciphertext1s);
             cc->RescaleInPlace(ciphertext2);
 
+            // level drops share the params of the modulus chain; equal params held elsewhere,
+            // such as those of deserialized elements, are replaced by the shared ones
+            const auto cryptoParams =
+                std::dynamic_pointer_cast<CryptoParametersCKKSMod>(cc->GetCryptoParameters());
+            const auto params = ciphertext1->GetElements()[0].GetParams();
+            EXPECT_TRUE(cryptoParams->HasParamsQl(params)) << failmsg;
+            EXPECT_TRUE(CryptoParametersCKKSMod(*cryptoParams).HasParamsQl(params)) << failmsg;
+            std::vector<Element> elements = ciphertext1->GetElements();
+            for (auto& element : elements)
+                element.DropLastElements(0, std::make_shared<Element::Params>(*params));
+            EXPECT_FALSE(cryptoParams->HasParamsQl(elements[0].GetParams())) << failmsg;
+            cryptoParams->InternElementParams(elements);
+            for (const auto& element : elements)
+                EXPECT_EQ(element.GetParams(), params) << failmsg;
+
             // Testing EvalMultAndRelinearize
             Ciphertext<Element> cResult;
             Plaintext results;
@@ -805,6 +926,585 @@ protected:
         }
     }
 
+    void UnitTest_Rank_Convert(const TEST_CASE_UTCKKSMod& testData, const std::string& failmsg = std::string()) {
+        try {
+            CryptoContext<Element> cc(UnitTestGenerateModuleContext(testData.params));
+
+            Plaintext plaintext1 = cc->MakeCKKSPackedPlaintext(vectorOfInts0_7, 1, 0, nullptr, testData.slots);
+            Plaintext plaintextDouble = cc->MakeCKKSPackedPlaintext(
+                std::vector<std::complex<double>>{0, 2, 4, 6, 8, 10, 12, 14}, 1, 0, nullptr, testData.slots);
+
+            KeyPair<Element> kp = cc->KeyGen();
+            PrivateKey<Element> reducedKey;
+            EvalKey<Element> reduceKey = cc->EvalRankRedKeyGen(kp.secretKey, reducedKey, 1);
+
+            Ciphertext<Element> ciphertext1 = cc->Encrypt(kp.publicKey, plaintext1);
+            Ciphertext<Element> reduced     = cc->EvalRankReduce(ciphertext1, reduceKey);
+            // by default the reduced key and ciphertext keep the tag of the original key
+            EXPECT_EQ(reducedKey->GetKeyTag(), kp.secretKey->GetKeyTag()) << failmsg;
+            EXPECT_EQ(reduced->GetKeyTag(), kp.secretKey->GetKeyTag()) << failmsg;
+
+            CryptoContext<DCRTPoly> ccRNS = GenCompatibleCryptoContextCKKSRNS(cc);
+            ccRNS->Enable(PKE);
+            ccRNS->Enable(KEYSWITCH);
+            ccRNS->Enable(LEVELEDSHE);
+            PrivateKey<DCRTPoly> skRNS = ConvertCKKSModToCKKSRNS(reducedKey, ccRNS);
+
+            Plaintext results;
+            Ciphertext<DCRTPoly> cRNS = ConvertCKKSModToCKKSRNS(reduced, ccRNS);
+            ccRNS->Decrypt(skRNS, cRNS, &results);
+            results->SetLength(plaintext1->GetLength());
+            checkEquality(plaintext1->GetCKKSPackedValue(), results->GetCKKSPackedValue(), eps,
+                          failmsg + " CKKSMod to CKKSRNS conversion fails");
+
+            // the moving conversion releases the input but leaves other owners of the ciphertext intact
+            Ciphertext<Element> alias = reduced;
+            cRNS                      = ConvertCKKSModToCKKSRNS(std::move(reduced), ccRNS);
+            EXPECT_FALSE(reduced) << failmsg << " conversion did not release the input";
+            EXPECT_EQ(alias->GetElements().size(), 2u) << failmsg << " conversion modified a shared ciphertext";
+
+            // keys generated from the converted secret key work on the converted ciphertexts
+            ccRNS->EvalRotateKeyGen(skRNS, {1});
+            Plaintext plaintextRotated = cc->MakeCKKSPackedPlaintext(
+                std::vector<std::complex<double>>{1, 2, 3, 4, 5, 6, 7, 0}, 1, 0, nullptr, testData.slots);
+            ccRNS->Decrypt(skRNS, ccRNS->EvalRotate(cRNS, 1), &results);
+            results->SetLength(plaintextRotated->GetLength());
+            checkEquality(plaintextRotated->GetCKKSPackedValue(), results->GetCKKSPackedValue(), eps,
+                          failmsg + " EvalRotate after the conversion fails");
+
+            // process on the RNS side and embed the result back
+            ccRNS->EvalAddInPlace(cRNS, cRNS);
+            Ciphertext<Element> cMod = ConvertCKKSRNSToCKKSMod(std::move(cRNS), cc);
+            cc->Decrypt(reducedKey, cMod, &results);
+            results->SetLength(plaintextDouble->GetLength());
+            checkEquality(plaintextDouble->GetCKKSPackedValue(), results->GetCKKSPackedValue(), eps,
+                          failmsg + " CKKSRNS to CKKSMod embedding fails");
+
+            PrivateKey<Element> skMod = ConvertCKKSRNSToCKKSMod(skRNS, cc);
+            EXPECT_TRUE(skMod->GetPrivateElement() == reducedKey->GetPrivateElement())
+                << failmsg << " secret key round trip fails";
+
+            // only rank-1 ciphertexts can be converted
+            EXPECT_THROW(ConvertCKKSModToCKKSRNS(ciphertext1, ccRNS), OpenFHEException) << failmsg;
+        }
+        catch (std::exception& e) {
+            std::cerr << "Exception thrown from " << __func__ << "(): " << e.what() << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+        catch (...) {
+            UNIT_TEST_HANDLE_ALL_EXCEPTIONS;
+        }
+    }
+
+    void UnitTest_Rank_Extend(const TEST_CASE_UTCKKSMod& testData, const std::string& failmsg = std::string()) {
+        try {
+            CryptoContext<Element> cc(UnitTestGenerateModuleContext(testData.params));
+
+            Plaintext plaintext1 = cc->MakeCKKSPackedPlaintext(vectorOfInts0_7, 1, 0, nullptr, testData.slots);
+            Plaintext plaintext2 = cc->MakeCKKSPackedPlaintext(vectorOfInts7_0, 1, 0, nullptr, testData.slots);
+            Plaintext plaintextMult = cc->MakeCKKSPackedPlaintext(
+                std::vector<std::complex<double>>({0, 6, 10, 12, 12, 10, 6, 0}), 1, 0, nullptr, testData.slots);
+            Plaintext plaintextMultAdd = cc->MakeCKKSPackedPlaintext(
+                std::vector<std::complex<double>>({0, 7, 12, 15, 16, 15, 12, 7}), 1, 0, nullptr, testData.slots);
+
+            KeyPair<Element> kp = cc->KeyGen();
+            cc->EvalMultModKeyGen(kp.secretKey);
+
+            // rank-1 key with its own relinearization keys and the key back to the full rank
+            PrivateKey<Element> lowKey;
+            EvalKey<Element> reduceKey = cc->EvalRankRedKeyGen(kp.secretKey, lowKey, 1, true);
+            cc->EvalMultModKeyGen(lowKey);
+            EvalKey<Element> extendKey = cc->EvalRankExtendKeyGen(lowKey, kp.secretKey);
+
+            Ciphertext<Element> ciphertext1 = cc->Encrypt(kp.publicKey, plaintext1);
+            Ciphertext<Element> ciphertext2 = cc->Encrypt(kp.publicKey, plaintext2);
+            Ciphertext<Element> cLow1       = cc->EvalRankReduce(ciphertext1, reduceKey);
+            Ciphertext<Element> cLow2       = cc->EvalRankReduce(ciphertext2, reduceKey);
+            EXPECT_NE(lowKey->GetKeyTag(), kp.secretKey->GetKeyTag()) << failmsg;
+            EXPECT_EQ(cLow1->GetKeyTag(), lowKey->GetKeyTag()) << failmsg;
+
+            // relinearized products with BV key switching carry an error of about 1e-8
+            const double tol = (testData.params.ksTech == BV) ? epsHigh : eps;
+
+            // the product is computed at rank 1 with the relinearization keys of the reduced key
+            Plaintext results;
+            Ciphertext<Element> cMultLow = cc->EvalMultAndRelinearize(cLow1, cLow2);
+            cc->Decrypt(lowKey, cMultLow, &results);
+            results->SetLength(plaintextMult->GetLength());
+            checkEquality(plaintextMult->GetCKKSPackedValue(), results->GetCKKSPackedValue(), tol,
+                          failmsg + " EvalMultAndRelinearize at the reduced rank fails");
+
+            Ciphertext<Element> cExtended = cc->EvalRankExtend(cMultLow, extendKey);
+            EXPECT_EQ(cExtended->GetElements()[1].GetModuleCols(), MODULE_RANK) << failmsg;
+            cc->Decrypt(kp.secretKey, cExtended, &results);
+            results->SetLength(plaintextMult->GetLength());
+            checkEquality(plaintextMult->GetCKKSPackedValue(), results->GetCKKSPackedValue(), tol,
+                          failmsg + " EvalRankExtend fails");
+
+            // the extended ciphertext combines with ciphertexts of the full rank
+            Ciphertext<Element> cResult = cc->EvalAdd(cExtended, ciphertext1);
+            cc->Decrypt(kp.secretKey, cResult, &results);
+            results->SetLength(plaintextMultAdd->GetLength());
+            checkEquality(plaintextMultAdd->GetCKKSPackedValue(), results->GetCKKSPackedValue(), tol,
+                          failmsg + " EvalAdd after EvalRankExtend fails");
+
+            EXPECT_THROW(cc->EvalMultNoRelin(cLow1, ciphertext2), OpenFHEException) << failmsg;
+        }
+        catch (std::exception& e) {
+            std::cerr << "Exception thrown from " << __func__ << "(): " << e.what() << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+        catch (...) {
+            UNIT_TEST_HANDLE_ALL_EXCEPTIONS;
+        }
+    }
+
+    void UnitTest_Rank_Reduce_Batch(const TEST_CASE_UTCKKSMod& testData,
+                                    const std::string& failmsg = std::string()) {
+        try {
+            CryptoContext<Element> cc(UnitTestGenerateModuleContext(testData.params));
+
+            Plaintext plaintext1 = cc->MakeCKKSPackedPlaintext(vectorOfInts0_7, 1, 0, nullptr, testData.slots);
+            Plaintext plaintextLow = cc->MakeCKKSPackedPlaintext(vectorOfInts0_7, 1, 1, nullptr, testData.slots);
+
+            KeyPair<Element> kp = cc->KeyGen();
+            PrivateKey<Element> reducedKey;
+            EvalKey<Element> reduceKey = cc->EvalRankRedKeyGen(kp.secretKey, reducedKey, MODULE_RANK / 2);
+
+            // more ciphertexts than one block of the batched key switch, at two levels, so that the
+            // batch is split both by size and by level
+            constexpr size_t count = 11;
+            std::vector<ConstCiphertext<Element>> ciphertexts;
+            for (size_t m = 0; m < count; ++m)
+                ciphertexts.push_back(cc->Encrypt(kp.publicKey, (m % 4 == 3) ? plaintextLow : plaintext1));
+
+            std::vector<Ciphertext<Element>> batch = cc->EvalRankReduceBatch(ciphertexts, reduceKey);
+            ASSERT_EQ(batch.size(), count) << failmsg;
+
+            Plaintext results;
+            for (size_t m = 0; m < count; ++m) {
+                Ciphertext<Element> single = cc->EvalRankReduce(ciphertexts[m], reduceKey);
+                EXPECT_EQ(batch[m]->GetKeyTag(), single->GetKeyTag()) << failmsg << " key tag of ciphertext " << m;
+                EXPECT_EQ(batch[m]->GetLevel(), single->GetLevel()) << failmsg << " level of ciphertext " << m;
+                EXPECT_TRUE(batch[m]->GetElements() == single->GetElements())
+                    << failmsg << " EvalRankReduceBatch differs from EvalRankReduce for ciphertext " << m;
+
+                cc->Decrypt(reducedKey, batch[m], &results);
+                results->SetLength(plaintext1->GetLength());
+                checkEquality(plaintext1->GetCKKSPackedValue(), results->GetCKKSPackedValue(), eps,
+                              failmsg + " EvalRankReduceBatch fails for ciphertext " + std::to_string(m));
+            }
+
+            EXPECT_TRUE(cc->EvalRankReduceBatch({}, reduceKey).empty()) << failmsg;
+        }
+        catch (std::exception& e) {
+            std::cerr << "Exception thrown from " << __func__ << "(): " << e.what() << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+        catch (...) {
+            UNIT_TEST_HANDLE_ALL_EXCEPTIONS;
+        }
+    }
+
+    void UnitTest_Mult_Plaintext(const TEST_CASE_UTCKKSMod& testData, const std::string& failmsg = std::string()) {
+        try {
+            CryptoContext<Element> cc(UnitTestGenerateModuleContext(testData.params));
+
+            Plaintext plaintext1 = cc->MakeCKKSPackedPlaintext(vectorOfInts0_7, 1, 0, nullptr, testData.slots);
+            Plaintext plaintext2 = cc->MakeCKKSPackedPlaintext(vectorOfInts7_0, 1, 0, nullptr, testData.slots);
+            // encoded below the level of fresh ciphertexts: only its first towers are used
+            Plaintext plaintext2Deep = cc->MakeCKKSPackedPlaintext(vectorOfInts7_0, 1, 1, nullptr, testData.slots);
+            Plaintext plaintext1s    = cc->MakeCKKSPackedPlaintext(vectorOfInts1s, 1, 0, nullptr, testData.slots);
+            Plaintext plaintextAdd   = cc->MakeCKKSPackedPlaintext(
+                std::vector<std::complex<double>>({7, 7, 7, 7, 7, 7, 7, 7}), 1, 0, nullptr, testData.slots);
+            Plaintext plaintextSub = cc->MakeCKKSPackedPlaintext(
+                std::vector<std::complex<double>>({-7, -5, -3, -1, 1, 3, 5, 7}), 1, 0, nullptr, testData.slots);
+            Plaintext plaintextMult = cc->MakeCKKSPackedPlaintext(
+                std::vector<std::complex<double>>({0, 6, 10, 12, 12, 10, 6, 0}), 1, 0, nullptr, testData.slots);
+            Plaintext plaintextMultAdd = cc->MakeCKKSPackedPlaintext(
+                std::vector<std::complex<double>>({0, 7, 12, 15, 16, 15, 12, 7}), 1, 0, nullptr, testData.slots);
+
+            KeyPair<Element> kp = cc->KeyGen();
+            cc->EvalMultModKeyGen(kp.secretKey);
+
+            Ciphertext<Element> ciphertext1  = cc->Encrypt(kp.publicKey, plaintext1);
+            Ciphertext<Element> ciphertext1s = cc->Encrypt(kp.publicKey, plaintext1s);
+
+            Ciphertext<Element> cResult;
+            Plaintext results;
+
+            cResult = cc->EvalAdd(ciphertext1, plaintext2);
+            cc->Decrypt(kp.secretKey, cResult, &results);
+            results->SetLength(plaintextAdd->GetLength());
+            checkEquality(plaintextAdd->GetCKKSPackedValue(), results->GetCKKSPackedValue(), eps,
+                          failmsg + " EvalAdd Ct and Pt fails");
+
+            cResult = cc->EvalSub(ciphertext1, plaintext2);
+            cc->Decrypt(kp.secretKey, cResult, &results);
+            results->SetLength(plaintextSub->GetLength());
+            checkEquality(plaintextSub->GetCKKSPackedValue(), results->GetCKKSPackedValue(), eps,
+                          failmsg + " EvalSub Ct and Pt fails");
+
+            // the same plaintext is used twice, so it must not be modified by the first product
+            for (size_t i = 0; i < 2; ++i) {
+                cResult = cc->EvalMult(ciphertext1, plaintext2);
+                cc->Decrypt(kp.secretKey, cResult, &results);
+                results->SetLength(plaintextMult->GetLength());
+                checkEquality(plaintextMult->GetCKKSPackedValue(), results->GetCKKSPackedValue(), eps,
+                              failmsg + " EvalMult Ct and Pt fails");
+            }
+
+            // the sum needs the plaintext raised to the depth of the product
+            cResult = cc->EvalAdd(cResult, plaintext1);
+            cc->Decrypt(kp.secretKey, cResult, &results);
+            results->SetLength(plaintextMultAdd->GetLength());
+            checkEquality(plaintextMultAdd->GetCKKSPackedValue(), results->GetCKKSPackedValue(), eps,
+                          failmsg + " EvalAdd Pt after EvalMult Ct and Pt fails");
+
+            cResult = cc->EvalMult(ciphertext1, plaintext2Deep);
+            cc->Decrypt(kp.secretKey, cResult, &results);
+            results->SetLength(plaintextMult->GetLength());
+            checkEquality(plaintextMult->GetCKKSPackedValue(), results->GetCKKSPackedValue(), eps,
+                          failmsg + " EvalMult Ct and Pt at a lower level fails");
+
+            // a ciphertext below the level of the plaintext
+            Ciphertext<Element> cDeep = cc->EvalMultAndRelinearize(ciphertext1, ciphertext1s);
+            cc->RescaleInPlace(cDeep);
+            cResult = cc->EvalMult(cDeep, plaintext2);
+            cc->Decrypt(kp.secretKey, cResult, &results);
+            results->SetLength(plaintextMult->GetLength());
+            checkEquality(plaintextMult->GetCKKSPackedValue(), results->GetCKKSPackedValue(), eps,
+                          failmsg + " EvalMult Ct at a lower level and Pt fails");
+        }
+        catch (std::exception& e) {
+            std::cerr << "Exception thrown from " << __func__ << "(): " << e.what() << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+        catch (...) {
+            UNIT_TEST_HANDLE_ALL_EXCEPTIONS;
+        }
+    }
+
+    void UnitTest_Eval_Scalar(const TEST_CASE_UTCKKSMod& testData, const std::string& failmsg = std::string()) {
+        try {
+            CryptoContext<Element> cc(UnitTestGenerateModuleContext(testData.params));
+
+            Plaintext plaintext1    = cc->MakeCKKSPackedPlaintext(vectorOfInts0_7, 1, 0, nullptr, testData.slots);
+            Plaintext plaintext1s   = cc->MakeCKKSPackedPlaintext(vectorOfInts1s, 1, 0, nullptr, testData.slots);
+            Plaintext plaintextAdd  = cc->MakeCKKSPackedPlaintext(
+                std::vector<std::complex<double>>({2.5, 3.5, 4.5, 5.5, 6.5, 7.5, 8.5, 9.5}), 1, 0, nullptr, testData.slots);
+            Plaintext plaintextSub  = cc->MakeCKKSPackedPlaintext(
+                std::vector<std::complex<double>>({-2.5, -1.5, -0.5, 0.5, 1.5, 2.5, 3.5, 4.5}), 1, 0, nullptr, testData.slots);
+            Plaintext plaintextMult = cc->MakeCKKSPackedPlaintext(
+                std::vector<std::complex<double>>({0, -1.5, -3, -4.5, -6, -7.5, -9, -10.5}), 1, 0, nullptr, testData.slots);
+            Plaintext plaintextAffine = cc->MakeCKKSPackedPlaintext(
+                std::vector<std::complex<double>>({0.25, -1.25, -2.75, -4.25, -5.75, -7.25, -8.75, -10.25}), 1, 0,
+                nullptr, testData.slots);
+
+            KeyPair<Element> kp = cc->KeyGen();
+            cc->EvalMultModKeyGen(kp.secretKey);
+
+            Ciphertext<Element> ciphertext1  = cc->Encrypt(kp.publicKey, plaintext1);
+            Ciphertext<Element> ciphertext1s = cc->Encrypt(kp.publicKey, plaintext1s);
+
+            Ciphertext<Element> cResult;
+            Plaintext results;
+
+            cResult = cc->EvalAdd(ciphertext1, 2.5);
+            cc->Decrypt(kp.secretKey, cResult, &results);
+            results->SetLength(plaintextAdd->GetLength());
+            checkEquality(plaintextAdd->GetCKKSPackedValue(), results->GetCKKSPackedValue(), eps,
+                          failmsg + " EvalAdd Ct and double fails");
+
+            cResult = cc->EvalSub(ciphertext1, 2.5);
+            cc->Decrypt(kp.secretKey, cResult, &results);
+            results->SetLength(plaintextSub->GetLength());
+            checkEquality(plaintextSub->GetCKKSPackedValue(), results->GetCKKSPackedValue(), eps,
+                          failmsg + " EvalSub Ct and double fails");
+
+            cResult = cc->EvalMult(ciphertext1, -1.5);
+            cc->Decrypt(kp.secretKey, cResult, &results);
+            results->SetLength(plaintextMult->GetLength());
+            checkEquality(plaintextMult->GetCKKSPackedValue(), results->GetCKKSPackedValue(), eps,
+                          failmsg + " EvalMult Ct and double fails");
+
+            // the constant is added at the depth of the product
+            cResult = cc->EvalAdd(cResult, 0.25);
+            cc->Decrypt(kp.secretKey, cResult, &results);
+            results->SetLength(plaintextAffine->GetLength());
+            checkEquality(plaintextAffine->GetCKKSPackedValue(), results->GetCKKSPackedValue(), eps,
+                          failmsg + " EvalAdd double after EvalMult Ct and double fails");
+
+            // a ciphertext below the top level
+            Ciphertext<Element> cDeep = cc->EvalMultAndRelinearize(ciphertext1, ciphertext1s);
+            cc->RescaleInPlace(cDeep);
+            cResult = cc->EvalMult(cDeep, -1.5);
+            cc->EvalAddInPlace(cResult, 0.25);
+            cc->Decrypt(kp.secretKey, cResult, &results);
+            results->SetLength(plaintextAffine->GetLength());
+            checkEquality(plaintextAffine->GetCKKSPackedValue(), results->GetCKKSPackedValue(), eps,
+                          failmsg + " EvalMult and EvalAdd double at a lower level fails");
+        }
+        catch (std::exception& e) {
+            std::cerr << "Exception thrown from " << __func__ << "(): " << e.what() << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+        catch (...) {
+            UNIT_TEST_HANDLE_ALL_EXCEPTIONS;
+        }
+    }
+
+    void UnitTest_Eval_Square(const TEST_CASE_UTCKKSMod& testData, const std::string& failmsg = std::string()) {
+        try {
+            CryptoContext<Element> cc(UnitTestGenerateModuleContext(testData.params));
+
+            Plaintext plaintext1 = cc->MakeCKKSPackedPlaintext(vectorOfInts0_7, 1, 0, nullptr, testData.slots);
+            Plaintext plaintextSquare = cc->MakeCKKSPackedPlaintext(
+                std::vector<std::complex<double>>({0, 1, 4, 9, 16, 25, 36, 49}), 1, 0, nullptr, testData.slots);
+            Plaintext plaintextFourth = cc->MakeCKKSPackedPlaintext(
+                std::vector<std::complex<double>>({0, 1, 16, 81, 256, 625, 1296, 2401}), 1, 0, nullptr, testData.slots);
+
+            KeyPair<Element> kp = cc->KeyGen();
+            cc->EvalMultModKeyGen(kp.secretKey);
+
+            Ciphertext<Element> ciphertext1 = cc->Encrypt(kp.publicKey, plaintext1);
+
+            Ciphertext<Element> cResult;
+            Plaintext results;
+
+            cResult = cc->EvalSquareAndRelinearize(ciphertext1);
+            cc->Decrypt(kp.secretKey, cResult, &results);
+            results->SetLength(plaintextSquare->GetLength());
+            checkEquality(plaintextSquare->GetCKKSPackedValue(), results->GetCKKSPackedValue(), epsHigh,
+                          failmsg + " EvalSquareAndRelinearize fails");
+
+            // the square has the layout of the product of the ciphertext with itself
+            Ciphertext<Element> cSquare = cc->GetScheme()->EvalSquare(ciphertext1);
+            Ciphertext<Element> cMult   = cc->EvalMultNoRelin(ciphertext1, ciphertext1);
+            ASSERT_EQ(cSquare->NumberCiphertextElements(), cMult->NumberCiphertextElements()) << failmsg;
+            for (size_t i = 0; i < cSquare->NumberCiphertextElements(); ++i) {
+                EXPECT_EQ(cSquare->GetElements()[i], cMult->GetElements()[i])
+                    << failmsg << " EvalSquare differs from EvalMultNoRelin in element " << i;
+            }
+
+            // squaring a square rescales it first in the automatic modes
+            if (testData.params.scalTech == FIXEDMANUAL)
+                cc->RescaleInPlace(cResult);
+            cResult = cc->EvalSquareAndRelinearize(cResult);
+            cc->Decrypt(kp.secretKey, cResult, &results);
+            results->SetLength(plaintextFourth->GetLength());
+            checkEquality(plaintextFourth->GetCKKSPackedValue(), results->GetCKKSPackedValue(), epsHigh,
+                          failmsg + " EvalSquareAndRelinearize of a square fails");
+
+            EXPECT_THROW(cc->EvalSquare(ciphertext1), OpenFHEException) << failmsg;
+        }
+        catch (std::exception& e) {
+            std::cerr << "Exception thrown from " << __func__ << "(): " << e.what() << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+        catch (...) {
+            UNIT_TEST_HANDLE_ALL_EXCEPTIONS;
+        }
+    }
+
+    void UnitTest_Eval_Rotate(const TEST_CASE_UTCKKSMod& testData, const std::string& failmsg = std::string()) {
+        try {
+            CryptoContext<Element> cc(UnitTestGenerateModuleContext(testData.params));
+
+            Plaintext plaintext1 = cc->MakeCKKSPackedPlaintext(vectorOfInts0_7, 1, 0, nullptr, testData.slots);
+            Plaintext plaintextLeft1 = cc->MakeCKKSPackedPlaintext(
+                std::vector<std::complex<double>>({1, 2, 3, 4, 5, 6, 7, 0}), 1, 0, nullptr, testData.slots);
+            Plaintext plaintextLeft2 = cc->MakeCKKSPackedPlaintext(
+                std::vector<std::complex<double>>({2, 3, 4, 5, 6, 7, 0, 1}), 1, 0, nullptr, testData.slots);
+            Plaintext plaintextRight1 = cc->MakeCKKSPackedPlaintext(
+                std::vector<std::complex<double>>({7, 0, 1, 2, 3, 4, 5, 6}), 1, 0, nullptr, testData.slots);
+            Plaintext plaintextSquareLeft1 = cc->MakeCKKSPackedPlaintext(
+                std::vector<std::complex<double>>({1, 4, 9, 16, 25, 36, 49, 0}), 1, 0, nullptr, testData.slots);
+
+            KeyPair<Element> kp = cc->KeyGen();
+            cc->EvalMultModKeyGen(kp.secretKey);
+            cc->EvalRotateKeyGen(kp.secretKey, {1, 2, -1});
+
+            Ciphertext<Element> ciphertext1 = cc->Encrypt(kp.publicKey, plaintext1);
+
+            Ciphertext<Element> cResult;
+            Plaintext results;
+
+            cResult = cc->EvalRotate(ciphertext1, 1);
+            cc->Decrypt(kp.secretKey, cResult, &results);
+            results->SetLength(plaintextLeft1->GetLength());
+            checkEquality(plaintextLeft1->GetCKKSPackedValue(), results->GetCKKSPackedValue(), eps,
+                          failmsg + " EvalRotate by 1 fails");
+
+            cResult = cc->EvalRotate(ciphertext1, -1);
+            cc->Decrypt(kp.secretKey, cResult, &results);
+            results->SetLength(plaintextRight1->GetLength());
+            checkEquality(plaintextRight1->GetCKKSPackedValue(), results->GetCKKSPackedValue(), eps,
+                          failmsg + " EvalRotate by -1 fails");
+
+            // hoisted rotations share the digits of one precomputation
+            const usint M = cc->GetCyclotomicOrder();
+            auto digits   = cc->EvalFastRotationPrecompute(ciphertext1);
+
+            cResult = cc->EvalFastRotation(ciphertext1, 2, M, digits);
+            cc->Decrypt(kp.secretKey, cResult, &results);
+            results->SetLength(plaintextLeft2->GetLength());
+            checkEquality(plaintextLeft2->GetCKKSPackedValue(), results->GetCKKSPackedValue(), eps,
+                          failmsg + " EvalFastRotation by 2 fails");
+
+            std::vector<Ciphertext<Element>> cRotated = cc->EvalFastRotationBatch(ciphertext1, {1, 0, -1, 2}, M, digits);
+            ASSERT_EQ(cRotated.size(), 4u) << failmsg;
+            const std::vector<Plaintext> expected{plaintextLeft1, plaintext1, plaintextRight1, plaintextLeft2};
+            for (size_t i = 0; i < expected.size(); ++i) {
+                cc->Decrypt(kp.secretKey, cRotated[i], &results);
+                results->SetLength(expected[i]->GetLength());
+                checkEquality(expected[i]->GetCKKSPackedValue(), results->GetCKKSPackedValue(), eps,
+                              failmsg + " EvalFastRotationBatch fails for index " + std::to_string(i));
+            }
+            // the batch computes the same key switches as the rotations one by one
+            for (size_t i = 0; i < cResult->NumberCiphertextElements(); ++i) {
+                EXPECT_EQ(cRotated[3]->GetElements()[i], cResult->GetElements()[i])
+                    << failmsg << " EvalFastRotationBatch differs from EvalFastRotation in element " << i;
+            }
+
+            // rotations at a lower level
+            cResult = cc->EvalMultAndRelinearize(ciphertext1, ciphertext1);
+            if (testData.params.scalTech == FIXEDMANUAL)
+                cc->RescaleInPlace(cResult);
+            cResult = cc->EvalRotate(cResult, 1);
+            cc->Decrypt(kp.secretKey, cResult, &results);
+            results->SetLength(plaintextSquareLeft1->GetLength());
+            checkEquality(plaintextSquareLeft1->GetCKKSPackedValue(), results->GetCKKSPackedValue(), epsHigh,
+                          failmsg + " EvalRotate of a product fails");
+
+            EXPECT_THROW(cc->EvalRotate(ciphertext1, 3), OpenFHEException) << failmsg;
+        }
+        catch (std::exception& e) {
+            std::cerr << "Exception thrown from " << __func__ << "(): " << e.what() << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+        catch (...) {
+            UNIT_TEST_HANDLE_ALL_EXCEPTIONS;
+        }
+    }
+
+    void UnitTest_Decrypt_No_Relin(const TEST_CASE_UTCKKSMod& testData, const std::string& failmsg = std::string()) {
+        try {
+            CryptoContext<Element> cc(UnitTestGenerateModuleContext(testData.params));
+
+            Plaintext plaintext1 = cc->MakeCKKSPackedPlaintext(vectorOfInts0_7, 1, 0, nullptr, testData.slots);
+            Plaintext plaintext2 = cc->MakeCKKSPackedPlaintext(vectorOfInts7_0, 1, 0, nullptr, testData.slots);
+            Plaintext plaintextMult = cc->MakeCKKSPackedPlaintext(
+                std::vector<std::complex<double>>({0, 6, 10, 12, 12, 10, 6, 0}), 1, 0, nullptr, testData.slots);
+            Plaintext plaintextSquare = cc->MakeCKKSPackedPlaintext(
+                std::vector<std::complex<double>>({0, 1, 4, 9, 16, 25, 36, 49}), 1, 0, nullptr, testData.slots);
+
+            KeyPair<Element> kp = cc->KeyGen();
+            cc->EvalMultModKeyGen(kp.secretKey);
+
+            Ciphertext<Element> ciphertext1 = cc->Encrypt(kp.publicKey, plaintext1);
+            Ciphertext<Element> ciphertext2 = cc->Encrypt(kp.publicKey, plaintext2);
+
+            const size_t tensorSize = (testData.params.moduleRank > 1) ? 4 : 3;
+
+            Ciphertext<Element> cResult;
+            Plaintext results;
+            Plaintext resultsRelin;
+
+            cResult = cc->EvalMultNoRelin(ciphertext1, ciphertext2);
+            ASSERT_EQ(cResult->NumberCiphertextElements(), tensorSize) << failmsg;
+            cc->Decrypt(kp.secretKey, cResult, &results);
+            results->SetLength(plaintextMult->GetLength());
+            checkEquality(plaintextMult->GetCKKSPackedValue(), results->GetCKKSPackedValue(), epsHigh,
+                          failmsg + " Decrypt of EvalMultNoRelin fails");
+
+            cc->Decrypt(kp.secretKey, cc->EvalMultAndRelinearize(ciphertext1, ciphertext2), &resultsRelin);
+            cc->Decrypt(kp.secretKey, cResult, &results);
+            resultsRelin->SetLength(plaintextMult->GetLength());
+            results->SetLength(plaintextMult->GetLength());
+            checkEquality(resultsRelin->GetCKKSPackedValue(), results->GetCKKSPackedValue(), epsHigh,
+                          failmsg + " Decrypt of EvalMultNoRelin differs from the relinearized product");
+
+            cResult = cc->GetScheme()->EvalSquare(ciphertext1);
+            cc->Decrypt(kp.secretKey, cResult, &results);
+            results->SetLength(plaintextSquare->GetLength());
+            checkEquality(plaintextSquare->GetCKKSPackedValue(), results->GetCKKSPackedValue(), epsHigh,
+                          failmsg + " Decrypt of EvalSquare fails");
+
+            // the powers of the secret follow a private element that is replaced in the key
+            KeyPair<Element> kp2 = cc->KeyGen();
+            kp.secretKey->SetPrivateElement(kp2.secretKey->GetPrivateElement());
+            cResult =
+                cc->EvalMultNoRelin(cc->Encrypt(kp2.publicKey, plaintext1), cc->Encrypt(kp2.publicKey, plaintext2));
+            cc->Decrypt(kp.secretKey, cResult, &results);
+            results->SetLength(plaintextMult->GetLength());
+            checkEquality(plaintextMult->GetCKKSPackedValue(), results->GetCKKSPackedValue(), epsHigh,
+                          failmsg + " Decrypt of EvalMultNoRelin after SetPrivateElement fails");
+
+            // a tensored ciphertext of a different rank is rejected
+            std::vector<Element> elements = cResult->GetElements();
+            elements.resize(tensorSize == 4 ? 3 : 4, elements.back());
+            cResult->SetElements(std::move(elements));
+            EXPECT_THROW(cc->Decrypt(kp.secretKey, cResult, &results), OpenFHEException) << failmsg;
+        }
+        catch (std::exception& e) {
+            std::cerr << "Exception thrown from " << __func__ << "(): " << e.what() << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+        catch (...) {
+            UNIT_TEST_HANDLE_ALL_EXCEPTIONS;
+        }
+    }
+
+    void UnitTest_KeyGen_Seeded(const TEST_CASE_UTCKKSMod& testData, const std::string& failmsg = std::string()) {
+        try {
+            CryptoContext<Element> cc(UnitTestGenerateModuleContext(testData.params));
+
+            KeyPair<Element> kpOld = cc->KeyGen();
+            KeyPair<Element> kpNew = cc->KeyGen();
+
+            KeySwitchMod keySwitch;
+            const std::vector<uint32_t> aSeed     = {1, 2, 3, 4};
+            const std::vector<uint32_t> errorSeed = {5, 6, 7, 8};
+
+            // the same seeds give the same key whatever the number of threads
+            OpenFHEParallelControls.SetNumThreads(1);
+            EvalKey<Element> key1 = keySwitch.KeySwitchGenSeeded(kpOld.secretKey, kpNew.secretKey, aSeed, errorSeed);
+            OpenFHEParallelControls.SetNumThreads(OpenFHEParallelControls.GetMachineThreads());
+            EvalKey<Element> keyN = keySwitch.KeySwitchGenSeeded(kpOld.secretKey, kpNew.secretKey, aSeed, errorSeed);
+            OpenFHEParallelControls.Enable();
+
+            EXPECT_EQ(key1->GetAVector(), keyN->GetAVector()) << failmsg << " A depends on the number of threads";
+            EXPECT_EQ(key1->GetBVector(), keyN->GetBVector()) << failmsg << " b depends on the number of threads";
+
+            // another error seed changes b only
+            EvalKey<Element> keyE =
+                keySwitch.KeySwitchGenSeeded(kpOld.secretKey, kpNew.secretKey, aSeed, {5, 6, 7, 9});
+            EXPECT_EQ(key1->GetAVector(), keyE->GetAVector()) << failmsg;
+            EXPECT_NE(key1->GetBVector(), keyE->GetBVector()) << failmsg << " b ignores the error seed";
+
+            EXPECT_THROW(keySwitch.KeySwitchGenSeeded(kpOld.secretKey, kpNew.secretKey, {}, errorSeed),
+                         OpenFHEException)
+                << failmsg;
+        }
+        catch (std::exception& e) {
+            std::cerr << "Exception thrown from " << __func__ << "(): " << e.what() << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+        catch (...) {
+            UNIT_TEST_HANDLE_ALL_EXCEPTIONS;
+        }
+    }
+
     void UnitTest_Small_ScalingModSize(const TEST_CASE_UTCKKSMod& testData,
                                        const std::string& failmsg = std::string()) {
         try {
@@ -870,6 +1570,33 @@ TEST_P(UTCKKSMod, CKKSRNS) {
         case SMALL_SCALING_MOD_SIZE:
             UnitTest_Small_ScalingModSize(test, test.buildTestName());
             break;
+        case RANK_CONVERT:
+            UnitTest_Rank_Convert(test, test.buildTestName());
+            break;
+        case RANK_EXTEND:
+            UnitTest_Rank_Extend(test, test.buildTestName());
+            break;
+        case RANK_REDUCE_BATCH:
+            UnitTest_Rank_Reduce_Batch(test, test.buildTestName());
+            break;
+        case MULT_PLAINTEXT:
+            UnitTest_Mult_Plaintext(test, test.buildTestName());
+            break;
+        case EVAL_SCALAR:
+            UnitTest_Eval_Scalar(test, test.buildTestName());
+            break;
+        case EVAL_SQUARE:
+            UnitTest_Eval_Square(test, test.buildTestName());
+            break;
+        case EVAL_ROTATE:
+            UnitTest_Eval_Rotate(test, test.buildTestName());
+            break;
+        case DECRYPT_NO_RELIN:
+            UnitTest_Decrypt_No_Relin(test, test.buildTestName());
+            break;
+        case KEYGEN_SEEDED:
+            UnitTest_KeyGen_Seeded(test, test.buildTestName());
+            break;
         default:
             break;
     }
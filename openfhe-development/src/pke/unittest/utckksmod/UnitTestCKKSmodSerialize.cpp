@@ -0,0 +1,302 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Unit tests for serialization of the CKKS scheme over modules
+ */
+
+#include "UnitTestUtils.h"
+#include "UnitTestCCParams.h"
+#include "UnitTestCryptoContext.h"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "ciphertext-ser.h"
+#include "cryptocontext-ser.h"
+#include "key/key-ser.h"
+#include "scheme/ckksmod/ckksmod-ser.h"
+#include "globals.h"  // for SERIALIZE_PRECOMPUTE
+
+using namespace lbcrypto;
+
+//===========================================================================================================
+enum TEST_CASE_TYPE {
+    KEYS_AND_CIPHERTEXTS = 0,
+    RANK_REDUCTION_KEY,
+};
+
+static std::ostream& operator<<(std::ostream& os, const TEST_CASE_TYPE& type) {
+    std::string typeName;
+    switch (type) {
+        case KEYS_AND_CIPHERTEXTS:
+            typeName = "KEYS_AND_CIPHERTEXTS";
+            break;
+        case RANK_REDUCTION_KEY:
+            typeName = "RANK_REDUCTION_KEY";
+            break;
+        default:
+            typeName = "UNKNOWN";
+            break;
+    }
+    return os << typeName;
+}
+//===========================================================================================================
+struct TEST_CASE_UTCKKSMOD_SER {
+    TEST_CASE_TYPE testCaseType;
+    // test case description - MUST BE UNIQUE
+    std::string description;
+
+    UnitTestCCParams params;
+
+    std::string buildTestName() const {
+        std::stringstream ss;
+        ss << testCaseType << "_" << description;
+        return ss.str();
+    }
+    std::string toString() const {
+        std::stringstream ss;
+        ss << "testCaseType [" << testCaseType << "], " << params.toString();
+        return ss.str();
+    }
+};
+
+// this lambda provides a name to be printed for every test run by INSTANTIATE_TEST_SUITE_P.
+// the name MUST be constructed from digits, letters and '_' only
+static auto testName = [](const testing::TestParamInfo<TEST_CASE_UTCKKSMOD_SER>& test) {
+    return test.param.buildTestName();
+};
+
+static std::ostream& operator<<(std::ostream& os, const TEST_CASE_UTCKKSMOD_SER& test) {
+    return os << test.toString();
+}
+//===========================================================================================================
+constexpr usint RING_DIM    = 512;
+constexpr usint MULT_DEPTH  = 3;
+constexpr usint DSIZE       = 10;
+constexpr usint BATCH       = 8;
+constexpr usint MODULE_RANK = 4;
+constexpr usint COMPRESS    = 1;
+// clang-format off
+static std::vector<TEST_CASE_UTCKKSMOD_SER> testCases = {
+    // TestType,            Descr, Scheme,         RDim,     MultDepth,  SModSize, DSize, BatchSz, SecKeyDist, MaxRelinSkDeg, FModSize, SecLvl,       KSTech, ScalTech,    LDigits, PtMod, StdDev, EvalAddCt, KSCt, MultTech, EncTech, PREMode, multiparty, decryptnoise, execmode, noiseestimate, rank,        compress
+    { KEYS_AND_CIPHERTEXTS, "01", {CKKSMOD_SCHEME, RING_DIM, MULT_DEPTH, DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FIXEDMANUAL, DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK, DFLT}, },
+    { KEYS_AND_CIPHERTEXTS, "02", {CKKSMOD_SCHEME, RING_DIM, MULT_DEPTH, DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FIXEDAUTO,   DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK, DFLT}, },
+    { KEYS_AND_CIPHERTEXTS, "03", {CKKSMOD_SCHEME, RING_DIM, MULT_DEPTH, DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FIXEDMANUAL, DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK, COMPRESS}, },
+    { RANK_REDUCTION_KEY,   "01", {CKKSMOD_SCHEME, RING_DIM, MULT_DEPTH, DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FIXEDMANUAL, DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK, DFLT}, },
+    { RANK_REDUCTION_KEY,   "02", {CKKSMOD_SCHEME, RING_DIM, MULT_DEPTH, DFLT,     DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FIXEDMANUAL, DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT,    DFLT,       DFLT,         DFLT,     DFLT,          MODULE_RANK, COMPRESS}, },
+    // ==========================================
+};
+// clang-format on
+//===========================================================================================================
+class UTCKKSMOD_SER : public ::testing::TestWithParam<TEST_CASE_UTCKKSMOD_SER> {
+    using Element    = DCRTModule;
+    const double eps = EPSILON;
+
+    const std::vector<std::complex<double>> vals{1.0, 3.0, 5.0, 7.0, 9.0, 2.0, 4.0, 6.0};
+
+protected:
+    void SetUp() {}
+
+    void TearDown() {
+        CryptoContextImpl<DCRTModule>::ClearEvalMultKeys();
+        CryptoContextFactory<DCRTModule>::ReleaseAllContexts();
+    }
+
+    template <typename ST>
+    void TestKeysAndCiphertexts(const TEST_CASE_UTCKKSMOD_SER& testData, const ST& sertype,
+                                const std::string& failmsg = std::string()) {
+        try {
+            CryptoContextImpl<DCRTModule>::ClearEvalMultKeys();
+            CryptoContextFactory<DCRTModule>::ReleaseAllContexts();
+
+            CryptoContext<Element> cc(UnitTestGenerateModuleContext(testData.params));
+            {
+                std::stringstream s;
+                Serial::Serialize(cc, s, sertype);
+                ASSERT_TRUE(CryptoContextFactory<DCRTModule>::GetContextCount() == 1);
+                CryptoContextFactory<DCRTModule>::ReleaseAllContexts();
+                ASSERT_TRUE(CryptoContextFactory<DCRTModule>::GetContextCount() == 0);
+                Serial::Deserialize(cc, s, sertype);
+
+                ASSERT_TRUE(cc) << failmsg << " Deser failed";
+                ASSERT_TRUE(CryptoContextFactory<DCRTModule>::GetContextCount() == 1);
+                const auto cryptoParams =
+                    std::dynamic_pointer_cast<CryptoParametersRLWE<DCRTModule>>(cc->GetCryptoParameters());
+                EXPECT_EQ(cryptoParams->GetModuleRank(), MODULE_RANK)
+                    << failmsg << " Module rank mismatch after ser/deser";
+            }
+
+            KeyPair<Element> kp = cc->KeyGen();
+            KeyPair<Element> kpnew;
+            {
+                std::stringstream s;
+                Serial::Serialize(kp.publicKey, s, sertype);
+                Serial::Deserialize(kpnew.publicKey, s, sertype);
+                EXPECT_EQ(*kp.publicKey, *kpnew.publicKey) << failmsg << " Public key mismatch after ser/deser";
+            }
+            {
+                std::stringstream s;
+                Serial::Serialize(kp.secretKey, s, sertype);
+                Serial::Deserialize(kpnew.secretKey, s, sertype);
+                EXPECT_EQ(*kp.secretKey, *kpnew.secretKey) << failmsg << " Secret key mismatch after ser/deser";
+            }
+
+            cc->EvalMultModKeyGen(kp.secretKey);
+            std::stringstream ser;
+            EXPECT_EQ(CryptoContextImpl<DCRTModule>::SerializeEvalMultKey(ser, sertype, cc), true)
+                << failmsg << " eval mult key ser fails";
+            CryptoContextImpl<DCRTModule>::ClearEvalMultKeys();
+            EXPECT_EQ(CryptoContextImpl<DCRTModule>::DeserializeEvalMultKey(ser, sertype), true)
+                << failmsg << " eval mult key deser fails";
+
+            Plaintext plaintext           = cc->MakeCKKSPackedPlaintext(vals);
+            Ciphertext<Element> ciphertext = cc->Encrypt(kpnew.publicKey, plaintext);
+            Ciphertext<Element> newC;
+            {
+                std::stringstream s;
+                Serial::Serialize(ciphertext, s, sertype);
+                Serial::Deserialize(newC, s, sertype);
+                EXPECT_EQ(*ciphertext, *newC) << failmsg << " Ciphertext mismatch";
+            }
+            {
+                // entries that disagree on the number of towers cannot be written
+                Ciphertext<Element> badC = ciphertext->Clone();
+                auto& module             = badC->GetElements()[1];
+                auto entry               = module.GetDCRTPolyAt(0);
+                entry.DropLastElement();
+                module.SetDCRTPolyAt(0, std::move(entry));
+                std::stringstream s;
+                EXPECT_THROW(Serial::Serialize(badC, s, sertype), OpenFHEException)
+                    << failmsg << " Inconsistent module serialized";
+            }
+
+            // the deserialized relinearization keys are used by EvalMultAndRelinearize
+            Ciphertext<Element> cMult = cc->EvalMultAndRelinearize(newC, newC);
+            cc->RescaleInPlace(cMult);
+
+            Plaintext result;
+            cc->Decrypt(kpnew.secretKey, newC, &result);
+            result->SetLength(plaintext->GetLength());
+            checkEquality(plaintext->GetCKKSPackedValue(), result->GetCKKSPackedValue(), eps,
+                          failmsg + " Decrypted serialization test fails");
+
+            std::vector<std::complex<double>> squares(vals.size());
+            std::transform(vals.begin(), vals.end(), squares.begin(), [](const auto& v) { return v * v; });
+            Plaintext plaintextSquare = cc->MakeCKKSPackedPlaintext(squares);
+            cc->Decrypt(kpnew.secretKey, cMult, &result);
+            result->SetLength(plaintextSquare->GetLength());
+            checkEquality(plaintextSquare->GetCKKSPackedValue(), result->GetCKKSPackedValue(), eps,
+                          failmsg + " EvalMultAndRelinearize with deserialized keys fails");
+        }
+        catch (std::exception& e) {
+            std::cerr << "Exception thrown from " << __func__ << "(): " << e.what() << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+        catch (...) {
+            UNIT_TEST_HANDLE_ALL_EXCEPTIONS;
+        }
+    }
+    void UnitTestKeysAndCiphertexts(const TEST_CASE_UTCKKSMOD_SER& testData,
+                                    const std::string& failmsg = std::string()) {
+        TestKeysAndCiphertexts(testData, SerType::JSON, failmsg + " json");
+        TestKeysAndCiphertexts(testData, SerType::BINARY, failmsg + " binary");
+    }
+
+    template <typename ST>
+    void TestRankReductionKey(const TEST_CASE_UTCKKSMOD_SER& testData, const ST& sertype,
+                              const std::string& failmsg = std::string()) {
+        try {
+            CryptoContext<Element> cc(UnitTestGenerateModuleContext(testData.params));
+
+            KeyPair<Element> kp = cc->KeyGen();
+            PrivateKey<Element> reducedKey;
+            EvalKey<Element> reduceKey = cc->EvalRankRedKeyGen(kp.secretKey, reducedKey, MODULE_RANK / 2);
+
+            EvalKey<Element> newReduceKey;
+            {
+                std::stringstream s;
+                Serial::Serialize(reduceKey, s, sertype);
+                Serial::Deserialize(newReduceKey, s, sertype);
+                ASSERT_TRUE(newReduceKey) << failmsg << " Rank reduction key deserialize failed";
+                EXPECT_TRUE(reduceKey->key_compare(*newReduceKey)) << failmsg << " Rank reduction key mismatch";
+
+                if (!isDefaultValue(testData.params.compressEvalKeys)) {
+                    // the same key without its seed is serialized with A
+                    auto fullKey = std::make_shared<EvalKeyRelinImpl<Element>>(
+                        *std::dynamic_pointer_cast<EvalKeyRelinImpl<Element>>(reduceKey));
+                    fullKey->SetAVectorSeed(std::vector<uint32_t>(), 0);
+                    std::stringstream sFull;
+                    Serial::Serialize(EvalKey<Element>(fullKey), sFull, sertype);
+                    EXPECT_LT(s.str().size(), sFull.str().size()) << failmsg << " Rank reduction key is not compressed";
+                }
+            }
+
+            Plaintext plaintext            = cc->MakeCKKSPackedPlaintext(vals);
+            Ciphertext<Element> ciphertext = cc->Encrypt(kp.publicKey, plaintext);
+            Ciphertext<Element> reduced    = cc->EvalRankReduce(ciphertext, newReduceKey);
+
+            Plaintext result;
+            cc->Decrypt(reducedKey, reduced, &result);
+            result->SetLength(plaintext->GetLength());
+            checkEquality(plaintext->GetCKKSPackedValue(), result->GetCKKSPackedValue(), eps,
+                          failmsg + " Rank reduction with a deserialized key fails");
+        }
+        catch (std::exception& e) {
+            std::cerr << "Exception thrown from " << __func__ << "(): " << e.what() << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+        catch (...) {
+            UNIT_TEST_HANDLE_ALL_EXCEPTIONS;
+        }
+    }
+    void UnitTestRankReductionKey(const TEST_CASE_UTCKKSMOD_SER& testData,
+                                  const std::string& failmsg = std::string()) {
+        TestRankReductionKey(testData, SerType::JSON, failmsg + " json");
+        TestRankReductionKey(testData, SerType::BINARY, failmsg + " binary");
+    }
+};
+//===========================================================================================================
+TEST_P(UTCKKSMOD_SER, CKKSModSer) {
+    setupSignals();
+    auto test = GetParam();
+
+    if (test.testCaseType == KEYS_AND_CIPHERTEXTS)
+        UnitTestKeysAndCiphertexts(test, test.buildTestName());
+    else if (test.testCaseType == RANK_REDUCTION_KEY)
+        UnitTestRankReductionKey(test, test.buildTestName());
+}
+
+INSTANTIATE_TEST_SUITE_P(UnitTests, UTCKKSMOD_SER, ::testing::ValuesIn(testCases), testName);
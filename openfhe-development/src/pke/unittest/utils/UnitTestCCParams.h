@@ -68,6 +68,7 @@ struct UnitTestCCParams {
     double executionMode           = DFLT;  // CKKSRNS
     double noiseEstimate           = DFLT;  // CKKSRNS
     double moduleRank              = DFLT;  // CKKSMOD
+    double compressEvalKeys        = DFLT;  // CKKSMOD
 
     std::string toString() const;
 };
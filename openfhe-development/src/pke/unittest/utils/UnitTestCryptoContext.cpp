@@ -138,6 +138,9 @@ static void setCryptoContextParametersFromUnitTestCCParams(const UnitTestCCParam
         if (!isDefaultValue(params.moduleRank)) {
             parameters.SetModuleRank(params.moduleRank);
         }
+        if (!isDefaultValue(params.compressEvalKeys)) {
+            parameters.SetCompressEvalKeys(static_cast<bool>(std::round(params.compressEvalKeys)));
+        }
     }
 }
 //===========================================================================================================